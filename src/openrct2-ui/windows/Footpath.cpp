@@ -148,6 +148,10 @@ static int8_t _window_footpath_provisional_path_arrow_timer;
 static uint8_t _lastUpdatedCameraRotation = UINT8_MAX;
 static bool _footpathErrorOccured;
 
+// Counts the pieces built in bridge mode, a client may build several on predicted results before any is rejected.
+static uint32_t _footpathConstructCount;
+static uint32_t _footpathRollbackCount;
+
 /** rct2: 0x0098D8B4 */
 static constexpr const uint8_t DefaultPathSlope[] = {
     0,
@@ -977,6 +981,9 @@ static void window_footpath_construct()
 
     gGameCommandErrorTitle = STR_CANT_BUILD_FOOTPATH_HERE;
     auto footpathPlaceAction = FootpathPlaceAction(footpathLoc, slope, type, gFootpathConstructDirection);
+    auto constructCount = ++_footpathConstructCount;
+    auto previousFromPosition = gFootpathConstructFromPosition;
+    auto previousValidDirections = gFootpathConstructValidDirections;
     footpathPlaceAction.SetCallback([=](const GameAction* ga, const GameActionResult* result) {
         if (result->Error == GA_ERROR::OK)
         {
@@ -1007,6 +1014,17 @@ static void window_footpath_construct()
         }
         window_footpath_set_enabled_and_pressed_widgets();
     });
+    footpathPlaceAction.SetRejectedCallback([=](const GameAction* ga, const GameActionResult* result) {
+        // Rejections arrive in order, pieces built after an earlier rejected one were built from its predicted position
+        // so only the first rejection is undone.
+        if (constructCount > _footpathRollbackCount)
+        {
+            gFootpathConstructFromPosition = previousFromPosition;
+            gFootpathConstructValidDirections = previousValidDirections;
+            _footpathRollbackCount = _footpathConstructCount;
+            window_footpath_set_enabled_and_pressed_widgets();
+        }
+    });
     GameActions::Execute(&footpathPlaceAction);
 }
 
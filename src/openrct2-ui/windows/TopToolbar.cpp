@@ -1865,6 +1865,8 @@ static void window_top_toolbar_scenery_tool_down(const ScreenCoordsXY& windowPos
                             audio_play_sound_at_location(SoundId::PlaceItem, result->Position);
                         }
                     });
+                    // Play the sound without waiting for the server, there is nothing to undo if it is rejected.
+                    smallSceneryPlaceAction.SetRejectedCallback([](const GameAction* ga, const GameActionResult* result) {});
                     auto res = GameActions::Execute(&smallSceneryPlaceAction);
                     if (res->Error == GA_ERROR::OK)
                     {
@@ -1947,6 +1949,8 @@ static void window_top_toolbar_scenery_tool_down(const ScreenCoordsXY& windowPos
                     audio_play_sound_at_location(SoundId::PlaceItem, result->Position);
                 }
             });
+            // Play the sound without waiting for the server, there is nothing to undo if it is rejected.
+            wallPlaceAction.SetRejectedCallback([](const GameAction* ga, const GameActionResult* result) {});
             auto res = GameActions::Execute(&wallPlaceAction);
             break;
         }
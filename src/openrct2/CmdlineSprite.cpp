@@ -14,6 +14,7 @@
 #include "Context.h"
 #include "OpenRCT2.h"
 #include "core/Imaging.h"
+#include "core/JobPool.hpp"
 #include "drawing/Drawing.h"
 #include "drawing/ImageImporter.h"
 #include "object/ObjectLimits.h"
@@ -27,6 +28,8 @@
 #include <cmath>
 #include <cstring>
 #include <jansson.h>
+#include <string>
+#include <vector>
 
 #ifdef _WIN32
 #    include "core/String.hpp"
@@ -194,6 +197,23 @@ static bool sprite_file_save(const char* path)
     return true;
 }
 
+static void sprite_file_append(const rct_g1_element& element, const uint8_t* buffer, int bufferLength)
+{
+    spriteFileHeader.num_entries++;
+    spriteFileHeader.total_size += bufferLength;
+    spriteFileEntries = static_cast<rct_g1_element*>(
+        realloc(spriteFileEntries, spriteFileHeader.num_entries * sizeof(rct_g1_element)));
+
+    sprite_entries_make_relative();
+    spriteFileData = static_cast<uint8_t*>(realloc(spriteFileData, spriteFileHeader.total_size));
+    sprite_entries_make_absolute();
+
+    spriteFileEntries[spriteFileHeader.num_entries - 1] = element;
+    std::memcpy(spriteFileData + (spriteFileHeader.total_size - bufferLength), buffer, bufferLength);
+    spriteFileEntries[spriteFileHeader.num_entries - 1].offset = spriteFileData
+        + (spriteFileHeader.total_size - bufferLength);
+}
+
 static void sprite_file_close()
 {
     SafeFree(spriteFileEntries);
@@ -657,20 +677,7 @@ int32_t cmdline_for_sprite(const char** argv, int32_t argc)
             return -1;
         }
 
-        spriteFileHeader.num_entries++;
-        spriteFileHeader.total_size += bufferLength;
-        spriteFileEntries = static_cast<rct_g1_element*>(
-            realloc(spriteFileEntries, spriteFileHeader.num_entries * sizeof(rct_g1_element)));
-
-        sprite_entries_make_relative();
-        spriteFileData = static_cast<uint8_t*>(realloc(spriteFileData, spriteFileHeader.total_size));
-        sprite_entries_make_absolute();
-
-        spriteFileEntries[spriteFileHeader.num_entries - 1] = spriteElement;
-        std::memcpy(spriteFileData + (spriteFileHeader.total_size - bufferLength), buffer, bufferLength);
-        spriteFileEntries[spriteFileHeader.num_entries - 1].offset = spriteFileData
-            + (spriteFileHeader.total_size - bufferLength);
-
+        sprite_file_append(spriteElement, buffer, bufferLength);
         free(buffer);
         if (!sprite_file_save(spriteFilePath))
             return -1;
@@ -722,6 +729,22 @@ int32_t cmdline_for_sprite(const char** argv, int32_t argc)
 
         fprintf(stdout, "Building: %s\n", spriteFilePath);
 
+        struct SpriteDescription
+        {
+            std::string ImagePath;
+            int16_t XOffset{};
+            int16_t YOffset{};
+            bool KeepPalette{};
+            bool ForceBmp{};
+
+            bool Imported{};
+            rct_g1_element Element{};
+            uint8_t* Buffer{};
+            int BufferLength{};
+        };
+
+        std::vector<SpriteDescription> sprites;
+
         size_t i;
         json_t* sprite_description;
 
@@ -765,57 +788,74 @@ int32_t cmdline_for_sprite(const char** argv, int32_t argc)
                 forceBmp = json_boolean_value(forceBmpObject);
             }
 
-            // Resolve absolute sprite path
-            auto imagePath = platform_get_absolute_path(json_string_value(path), directoryPath);
+            auto& sprite = sprites.emplace_back();
 
-            rct_g1_element spriteElement;
-            uint8_t* buffer;
-            int bufferLength;
+            // Resolve absolute sprite path
+            sprite.ImagePath = platform_get_absolute_path(json_string_value(path), directoryPath);
+            sprite.XOffset = x_offset == nullptr ? 0 : json_integer_value(x_offset);
+            sprite.YOffset = y_offset == nullptr ? 0 : json_integer_value(y_offset);
+            sprite.KeepPalette = keep_palette;
+            sprite.ForceBmp = forceBmp;
+        }
 
-            if (!sprite_file_import(
-                    imagePath.c_str(), x_offset == nullptr ? 0 : json_integer_value(x_offset),
-                    y_offset == nullptr ? 0 : json_integer_value(y_offset), keep_palette, forceBmp, &spriteElement, &buffer,
-                    &bufferLength, gSpriteMode))
+        // Images are independent of each other, so import them all in parallel
+        {
+            JobPool jobPool;
+            for (auto& sprite : sprites)
             {
-                fprintf(stderr, "Could not import image file: %s\nCanceling\n", imagePath.c_str());
-                json_decref(sprite_list);
-                return -1;
+                jobPool.AddTask([&sprite]() {
+                    sprite.Imported = sprite_file_import(
+                        sprite.ImagePath.c_str(), sprite.XOffset, sprite.YOffset, sprite.KeepPalette, sprite.ForceBmp,
+                        &sprite.Element, &sprite.Buffer, &sprite.BufferLength, gSpriteMode);
+                });
             }
+            jobPool.Join();
+        }
 
-            if (!sprite_file_open(spriteFilePath))
+        if (!sprite_file_open(spriteFilePath))
+        {
+            fprintf(stderr, "Unable to open sprite file: %s\nCanceling\n", spriteFilePath);
+            for (auto& sprite : sprites)
             {
-                fprintf(stderr, "Unable to open sprite file: %s\nCanceling\n", spriteFilePath);
-                json_decref(sprite_list);
-                return -1;
+                free(sprite.Buffer);
             }
+            json_decref(sprite_list);
+            return -1;
+        }
 
-            spriteFileHeader.num_entries++;
-            spriteFileHeader.total_size += bufferLength;
-            spriteFileEntries = static_cast<rct_g1_element*>(
-                realloc(spriteFileEntries, spriteFileHeader.num_entries * sizeof(rct_g1_element)));
-
-            sprite_entries_make_relative();
-            spriteFileData = static_cast<uint8_t*>(realloc(spriteFileData, spriteFileHeader.total_size));
-            sprite_entries_make_absolute();
-
-            spriteFileEntries[spriteFileHeader.num_entries - 1] = spriteElement;
-            std::memcpy(spriteFileData + (spriteFileHeader.total_size - bufferLength), buffer, bufferLength);
-            spriteFileEntries[spriteFileHeader.num_entries - 1].offset = spriteFileData
-                + (spriteFileHeader.total_size - bufferLength);
-
-            free(buffer);
-
-            if (!sprite_file_save(spriteFilePath))
+        // Append the sprites in order, stopping at the first image that could not be imported
+        bool success = true;
+        for (auto& sprite : sprites)
+        {
+            if (!success || !sprite.Imported)
             {
-                fprintf(stderr, "Could not save sprite file: %s\nCanceling\n", imagePath.c_str());
-                json_decref(sprite_list);
-                return -1;
+                if (success)
+                {
+                    fprintf(stderr, "Could not import image file: %s\nCanceling\n", sprite.ImagePath.c_str());
+                    success = false;
+                }
+                free(sprite.Buffer);
+                continue;
             }
 
+            sprite_file_append(sprite.Element, sprite.Buffer, sprite.BufferLength);
+            free(sprite.Buffer);
+
             if (!silent)
-                fprintf(stdout, "Added: %s\n", imagePath.c_str());
+                fprintf(stdout, "Added: %s\n", sprite.ImagePath.c_str());
+        }
 
-            sprite_file_close();
+        if (!sprite_file_save(spriteFilePath))
+        {
+            fprintf(stderr, "Could not save sprite file: %s\nCanceling\n", spriteFilePath);
+            success = false;
+        }
+        sprite_file_close();
+
+        if (!success)
+        {
+            json_decref(sprite_list);
+            return -1;
         }
 
         json_decref(sprite_list);
@@ -119,6 +119,7 @@ namespace OpenRCT2
         uint32_t _lastTick = 0;
         uint32_t _accumulator = 0;
         uint32_t _lastUpdateTime = 0;
+        uint32_t _lastObjectRefreshTime = 0;
         bool _variableFrame = false;
 
         // If set, will end the OpenRCT2 game loop. Intentially private to this module so that the flag can not be set back to
@@ -429,6 +430,11 @@ namespace OpenRCT2
             //      still open the game window and draw a progress screen for the creation
             //      of the object cache.
             _objectRepository->LoadOrConstruct(_localisationService->GetCurrentLanguage());
+            if (gOpenRCT2Headless)
+            {
+                // Dedicated servers can run for a long time, pick up new objects without a restart
+                _objectRepository->StartWatching();
+            }
 
             // TODO Like objects, this can take a while if there are a lot of track designs
             //      its also really something really we might want to do in the background
@@ -923,7 +929,21 @@ namespace OpenRCT2
 
             if (_accumulator < GAME_UPDATE_TIME_MS)
             {
-                platform_sleep(GAME_UPDATE_TIME_MS - _accumulator - 1);
+                uint32_t timeUntilNextTick = GAME_UPDATE_TIME_MS - _accumulator - 1;
+                if (gOpenRCT2Headless && network_get_mode() == NETWORK_MODE_SERVER)
+                {
+                    // Handle incoming packets as they arrive rather than only once per tick, game actions received
+                    // this way are still queued for the next tick.
+                    if (network_wait_for_activity(timeUntilNextTick))
+                    {
+                        network_update();
+                        network_flush();
+                    }
+                }
+                else
+                {
+                    platform_sleep(timeUntilNextTick);
+                }
                 return;
             }
 
@@ -1028,6 +1048,12 @@ namespace OpenRCT2
             }
 #endif
 
+            if (gOpenRCT2Headless && currentUpdateTime - _lastObjectRefreshTime > 1000)
+            {
+                _objectRepository->Refresh(_localisationService->GetCurrentLanguage());
+                _lastObjectRefreshTime = currentUpdateTime;
+            }
+
             chat_update();
 #ifdef ENABLE_SCRIPTING
             _scriptEngine.Update();
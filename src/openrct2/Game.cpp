@@ -573,6 +573,10 @@ void game_load_init()
         GameActions::ClearQueue();
         reset_sprite_spatial_index();
     }
+    else
+    {
+        reset_sprite_spatial_grid();
+    }
     reset_all_sprite_quadrant_placements();
     scenery_set_default_placement_configuration();
 
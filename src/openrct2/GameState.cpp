@@ -37,6 +37,7 @@
 #include "world/Scenery.h"
 
 #include <algorithm>
+#include <chrono>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Scripting;
@@ -227,6 +228,8 @@ void GameState::Update()
 
 void GameState::UpdateLogic()
 {
+    auto startTime = std::chrono::steady_clock::now();
+
     gScreenAge++;
     if (gScreenAge == 0)
         gScreenAge--;
@@ -324,6 +327,9 @@ void GameState::UpdateLogic()
     gScenarioTicks++;
     gSavedAge++;
 
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+    network_record_tick_duration(elapsed.count());
+
 #ifdef ENABLE_SCRIPTING
     auto& hookEngine = GetContext()->GetScriptEngine().GetHookEngine();
     hookEngine.Call(HOOK_TYPE::INTERVAL_TICK, true);
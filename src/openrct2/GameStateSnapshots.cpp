@@ -13,99 +13,332 @@
 #include "peep/Peep.h"
 #include "world/Sprite.h"
 
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
 static constexpr size_t MaximumGameStateSnapshots = 32;
 static constexpr uint32_t InvalidTick = 0xFFFFFFFF;
 
-struct GameStateSnapshot_t
+// Number of consecutive sprite indices that share a block.
+static constexpr uint32_t SpriteBlockSpan = 64;
+static constexpr uint32_t InvalidSpan = 0xFFFFFFFF;
+
+/**
+ * The stored data of all sprites of a single type within a range of SpriteBlockSpan sprite indices.
+ * Sprites are stored back to back in index order so that two snapshots can be compared block by block
+ * and blocks with equal hashes can be skipped entirely.
+ */
+struct GameStateSpriteBlock_t
+{
+    uint64_t key = 0;
+    uint8_t spriteIdentifier = SPRITE_IDENTIFIER_NULL;
+    uint8_t miscIdentifier = 0;
+    uint16_t dataSize = 0;
+    uint64_t hash = 0;
+    std::vector<uint32_t> indices;
+    std::vector<uint8_t> data;
+
+    static uint64_t GetKey(uint32_t spriteIndex, uint8_t spriteIdentifier, uint8_t miscIdentifier)
+    {
+        // Blocks are ordered by index range first so that all blocks of a range are adjacent
+        return (static_cast<uint64_t>(spriteIndex / SpriteBlockSpan) << 16) | (spriteIdentifier << 8) | miscIdentifier;
+    }
+
+    uint32_t GetSpan() const
+    {
+        return static_cast<uint32_t>(key >> 16);
+    }
+
+    void ComputeHash()
+    {
+        // FNV-1a
+        uint64_t h = 0xCBF29CE484222325ULL;
+        auto hashBytes = [&h](const uint8_t* bytes, size_t len) {
+            for (size_t i = 0; i < len; i++)
+            {
+                h ^= bytes[i];
+                h *= 0x100000001B3ULL;
+            }
+        };
+        hashBytes(reinterpret_cast<const uint8_t*>(indices.data()), indices.size() * sizeof(uint32_t));
+        hashBytes(data.data(), data.size());
+        hash = h;
+    }
+};
+
+/**
+ * Returns the number of bytes of a sprite that are stored in a snapshot, sprites of any other type only store
+ * their identifiers.
+ */
+static uint16_t GetSnapshotSpriteDataSize(uint8_t spriteIdentifier, uint8_t miscIdentifier)
 {
-    GameStateSnapshot_t& operator=(GameStateSnapshot_t&& mv) noexcept
+    switch (spriteIdentifier)
+    {
+        case SPRITE_IDENTIFIER_VEHICLE:
+            return sizeof(Vehicle);
+        case SPRITE_IDENTIFIER_PEEP:
+            return sizeof(Peep);
+        case SPRITE_IDENTIFIER_LITTER:
+            return sizeof(Litter);
+        case SPRITE_IDENTIFIER_MISC:
+            switch (miscIdentifier)
+            {
+                case SPRITE_MISC_MONEY_EFFECT:
+                    return sizeof(MoneyEffect);
+                case SPRITE_MISC_BALLOON:
+                    return sizeof(Balloon);
+                case SPRITE_MISC_DUCK:
+                    return sizeof(Duck);
+                case SPRITE_MISC_JUMPING_FOUNTAIN_WATER:
+                    return sizeof(JumpingFountain);
+                case SPRITE_MISC_STEAM_PARTICLE:
+                    return sizeof(SteamParticle);
+            }
+            break;
+    }
+    return 0;
+}
+
+/**
+ * Appends sprites, in ascending index order, to a list of sprite blocks sorted by key.
+ */
+class GameStateSpriteBlockBuilder
+{
+private:
+    std::vector<GameStateSpriteBlock_t>& _blocks;
+    size_t _spanStart = 0;
+    uint32_t _span = InvalidSpan;
+
+public:
+    explicit GameStateSpriteBlockBuilder(std::vector<GameStateSpriteBlock_t>& blocks)
+        : _blocks(blocks)
+    {
+        _blocks.clear();
+    }
+
+    void Add(uint32_t spriteIndex, uint8_t spriteIdentifier, uint8_t miscIdentifier, const void* data, uint16_t dataSize)
+    {
+        if (spriteIdentifier != SPRITE_IDENTIFIER_MISC)
+        {
+            miscIdentifier = 0;
+        }
+
+        auto key = GameStateSpriteBlock_t::GetKey(spriteIndex, spriteIdentifier, miscIdentifier);
+        auto span = spriteIndex / SpriteBlockSpan;
+        if (span != _span)
+        {
+            if (_span != InvalidSpan && span < _span)
+            {
+                throw std::runtime_error("Snapshot sprites are not in ascending order");
+            }
+            FinishSpan();
+            _span = span;
+        }
+
+        auto block = std::find_if(_blocks.begin() + _spanStart, _blocks.end(), [key](const GameStateSpriteBlock_t& b) {
+            return b.key == key;
+        });
+        if (block == _blocks.end())
+        {
+            block = _blocks.insert(_blocks.end(), GameStateSpriteBlock_t{});
+            block->key = key;
+            block->spriteIdentifier = spriteIdentifier;
+            block->miscIdentifier = miscIdentifier;
+            block->dataSize = dataSize;
+        }
+
+        block->indices.push_back(spriteIndex);
+        auto src = static_cast<const uint8_t*>(data);
+        block->data.insert(block->data.end(), src, src + dataSize);
+    }
+
+    void Finish()
+    {
+        FinishSpan();
+        _span = InvalidSpan;
+    }
+
+private:
+    void FinishSpan()
     {
-        tick = mv.tick;
-        storedSprites = std::move(mv.storedSprites);
-        return *this;
+        std::sort(
+            _blocks.begin() + _spanStart, _blocks.end(),
+            [](const GameStateSpriteBlock_t& a, const GameStateSpriteBlock_t& b) { return a.key < b.key; });
+        for (auto it = _blocks.begin() + _spanStart; it != _blocks.end(); it++)
+        {
+            it->ComputeHash();
+        }
+        _spanStart = _blocks.size();
     }
+};
 
+struct GameStateSnapshot_t
+{
     uint32_t tick = InvalidTick;
     uint32_t srand0 = 0;
 
-    MemoryStream storedSprites;
+    std::vector<GameStateSpriteBlock_t> spriteBlocks;
     MemoryStream parkParameters;
 
-    void SerialiseSprites(rct_sprite* sprites, const size_t numSprites, bool saving)
+    void CaptureSprites(const rct_sprite* sprites, const size_t numSprites)
     {
-        const bool loading = !saving;
-
-        storedSprites.SetPosition(0);
-        DataSerialiser ds(saving, storedSprites);
+        GameStateSpriteBlockBuilder builder(spriteBlocks);
+        for (size_t i = 0; i < numSprites; i++)
+        {
+            const auto& sprite = sprites[i];
+            if (sprite.generic.sprite_identifier == SPRITE_IDENTIFIER_NULL)
+                continue;
 
-        std::vector<uint32_t> indexTable;
-        indexTable.reserve(numSprites);
+            builder.Add(
+                static_cast<uint32_t>(i), sprite.generic.sprite_identifier, sprite.generic.type, &sprite,
+                GetSnapshotSpriteDataSize(sprite.generic.sprite_identifier, sprite.generic.type));
+        }
+        builder.Finish();
+    }
 
-        uint32_t numSavedSprites = 0;
+    /**
+     * Serialises the sprites in the same format as a plain list of sprites so that snapshots remain
+     * compatible with replays and other clients.
+     */
+    void SerialiseSprites(DataSerialiser& ds)
+    {
+        MemoryStream storedSprites;
+        if (ds.IsSaving())
+        {
+            WriteSprites(storedSprites);
+            ds << storedSprites;
+        }
+        else
+        {
+            ds << storedSprites;
+            ReadSprites(storedSprites);
+        }
+    }
 
-        if (saving)
+    /**
+     * Restores the sprites of a single block range into the given array of SpriteBlockSpan sprites, the
+     * range must be given as [begin, end) into spriteBlocks.
+     */
+    static void RestoreSpan(
+        std::vector<GameStateSpriteBlock_t>::const_iterator begin, std::vector<GameStateSpriteBlock_t>::const_iterator end,
+        rct_sprite* sprites)
+    {
+        for (size_t i = 0; i < SpriteBlockSpan; i++)
         {
-            for (size_t i = 0; i < numSprites; i++)
+            sprites[i] = rct_sprite();
+            sprites[i].generic.sprite_identifier = SPRITE_IDENTIFIER_NULL;
+        }
+        for (auto block = begin; block != end; block++)
+        {
+            for (size_t i = 0; i < block->indices.size(); i++)
             {
-                if (sprites[i].generic.sprite_identifier == SPRITE_IDENTIFIER_NULL)
-                    continue;
-                indexTable.push_back(static_cast<uint32_t>(i));
+                auto& sprite = sprites[block->indices[i] % SpriteBlockSpan];
+                sprite.generic.sprite_identifier = block->spriteIdentifier;
+                if (block->spriteIdentifier == SPRITE_IDENTIFIER_MISC)
+                {
+                    sprite.generic.type = block->miscIdentifier;
+                }
+                std::memcpy(&sprite, block->data.data() + i * block->dataSize, block->dataSize);
             }
-            numSavedSprites = static_cast<uint32_t>(indexTable.size());
         }
+    }
 
-        ds << numSavedSprites;
+private:
+    void WriteSprites(MemoryStream& stream) const
+    {
+        DataSerialiser ds(true, stream);
 
-        if (loading)
+        uint32_t numSavedSprites = 0;
+        for (const auto& block : spriteBlocks)
         {
-            indexTable.resize(numSavedSprites);
+            numSavedSprites += static_cast<uint32_t>(block.indices.size());
         }
+        ds << numSavedSprites;
 
-        for (uint32_t i = 0; i < numSavedSprites; i++)
+        // Merge the blocks of each range back into index order
+        struct SpriteRef
+        {
+            const GameStateSpriteBlock_t* Block;
+            size_t Position;
+        };
+        std::vector<SpriteRef> spanSprites;
+        for (auto spanBegin = spriteBlocks.begin(); spanBegin != spriteBlocks.end();)
         {
-            ds << indexTable[i];
+            auto span = spanBegin->GetSpan();
+            auto spanEnd = std::find_if(
+                spanBegin, spriteBlocks.end(), [span](const GameStateSpriteBlock_t& b) { return b.GetSpan() != span; });
+
+            spanSprites.clear();
+            for (auto block = spanBegin; block != spanEnd; block++)
+            {
+                for (size_t i = 0; i < block->indices.size(); i++)
+                {
+                    spanSprites.push_back({ &*block, i });
+                }
+            }
+            std::sort(spanSprites.begin(), spanSprites.end(), [](const SpriteRef& a, const SpriteRef& b) {
+                return a.Block->indices[a.Position] < b.Block->indices[b.Position];
+            });
+
+            for (const auto& ref : spanSprites)
+            {
+                uint32_t spriteIndex = ref.Block->indices[ref.Position];
+                ds << spriteIndex;
+                ds << ref.Block->spriteIdentifier;
+                if (ref.Block->spriteIdentifier == SPRITE_IDENTIFIER_MISC)
+                {
+                    ds << ref.Block->miscIdentifier;
+                }
+                if (ref.Block->dataSize != 0)
+                {
+                    // Same layout as a serialised uint8_t array
+                    ds << ref.Block->dataSize;
+                    ds.GetStream().Write(ref.Block->data.data() + ref.Position * ref.Block->dataSize, ref.Block->dataSize);
+                }
+            }
 
-            const uint32_t spriteIdx = indexTable[i];
-            rct_sprite& sprite = sprites[spriteIdx];
+            spanBegin = spanEnd;
+        }
+    }
 
-            ds << sprite.generic.sprite_identifier;
+    void ReadSprites(MemoryStream& stream)
+    {
+        stream.SetPosition(0);
+        DataSerialiser ds(false, stream);
+
+        uint32_t numSavedSprites = 0;
+        ds << numSavedSprites;
 
-            switch (sprite.generic.sprite_identifier)
+        rct_sprite sprite;
+        GameStateSpriteBlockBuilder builder(spriteBlocks);
+        for (uint32_t i = 0; i < numSavedSprites; i++)
+        {
+            uint32_t spriteIndex = 0;
+            uint8_t spriteIdentifier = SPRITE_IDENTIFIER_NULL;
+            uint8_t miscIdentifier = 0;
+            ds << spriteIndex;
+            ds << spriteIdentifier;
+            if (spriteIdentifier == SPRITE_IDENTIFIER_MISC)
             {
-                case SPRITE_IDENTIFIER_VEHICLE:
-                    ds << reinterpret_cast<uint8_t(&)[sizeof(Vehicle)]>(sprite.vehicle);
-                    break;
-                case SPRITE_IDENTIFIER_PEEP:
-                    ds << reinterpret_cast<uint8_t(&)[sizeof(Peep)]>(sprite.peep);
-                    break;
-                case SPRITE_IDENTIFIER_LITTER:
-                    ds << reinterpret_cast<uint8_t(&)[sizeof(Litter)]>(sprite.litter);
-                    break;
-                case SPRITE_IDENTIFIER_MISC:
+                ds << miscIdentifier;
+            }
+
+            auto dataSize = GetSnapshotSpriteDataSize(spriteIdentifier, miscIdentifier);
+            if (dataSize != 0)
+            {
+                uint16_t length = 0;
+                ds << length;
+                if (length != dataSize)
                 {
-                    ds << sprite.generic.type;
-                    switch (sprite.generic.type)
-                    {
-                        case SPRITE_MISC_MONEY_EFFECT:
-                            ds << reinterpret_cast<uint8_t(&)[sizeof(MoneyEffect)]>(sprite.money_effect);
-                            break;
-                        case SPRITE_MISC_BALLOON:
-                            ds << reinterpret_cast<uint8_t(&)[sizeof(Balloon)]>(sprite.balloon);
-                            break;
-                        case SPRITE_MISC_DUCK:
-                            ds << reinterpret_cast<uint8_t(&)[sizeof(Duck)]>(sprite.duck);
-                            break;
-                        case SPRITE_MISC_JUMPING_FOUNTAIN_WATER:
-                            ds << reinterpret_cast<uint8_t(&)[sizeof(JumpingFountain)]>(sprite.jumping_fountain);
-                            break;
-                        case SPRITE_MISC_STEAM_PARTICLE:
-                            ds << reinterpret_cast<uint8_t(&)[sizeof(SteamParticle)]>(sprite.steam_particle);
-                            break;
-                    }
+                    throw std::runtime_error("Invalid size, can't decode");
                 }
-                break;
+                ds.GetStream().Read(&sprite, dataSize);
             }
+            builder.Add(spriteIndex, spriteIdentifier, miscIdentifier, &sprite, dataSize);
         }
+        builder.Finish();
     }
 };
 
@@ -133,9 +366,7 @@ struct GameStateSnapshots final : public IGameStateSnapshots
     virtual void Capture(GameStateSnapshot_t& snapshot) override final
     {
         // TODO refactor to not use this as a proxy for getting a pointer to the sprite array
-        snapshot.SerialiseSprites(get_sprite(0), MAX_SPRITES, true);
-
-        // log_info("Snapshot size: %u bytes", static_cast<uint32_t>(snapshot.storedSprites.GetLength()));
+        snapshot.CaptureSprites(get_sprite(0), MAX_SPRITES);
     }
 
     virtual const GameStateSnapshot_t* GetLinkedSnapshot(uint32_t tick) const override final
@@ -152,26 +383,10 @@ struct GameStateSnapshots final : public IGameStateSnapshots
     {
         ds << snapshot.tick;
         ds << snapshot.srand0;
-        ds << snapshot.storedSprites;
+        snapshot.SerialiseSprites(ds);
         ds << snapshot.parkParameters;
     }
 
-    std::vector<rct_sprite> BuildSpriteList(GameStateSnapshot_t& snapshot) const
-    {
-        std::vector<rct_sprite> spriteList;
-        spriteList.resize(MAX_SPRITES);
-
-        for (auto& sprite : spriteList)
-        {
-            // By default they don't exist.
-            sprite.generic.sprite_identifier = SPRITE_IDENTIFIER_NULL;
-        }
-
-        snapshot.SerialiseSprites(spriteList.data(), MAX_SPRITES, false);
-
-        return spriteList;
-    }
-
 #define COMPARE_FIELD(struc, field)                                                                                            \
     if (std::memcmp(&spriteBase.field, &spriteCmp.field, sizeof(struc::field)) != 0)                                           \
     {                                                                                                                          \
@@ -517,6 +732,49 @@ struct GameStateSnapshots final : public IGameStateSnapshots
         }
     }
 
+    void CompareSprite(
+        uint32_t spriteIndex, const rct_sprite& spriteBase, const rct_sprite& spriteCmp, GameStateCompareData_t& res) const
+    {
+        GameStateSpriteChange_t changeData;
+        changeData.spriteIndex = spriteIndex;
+        changeData.spriteIdentifier = spriteBase.generic.sprite_identifier;
+        changeData.miscIdentifier = spriteBase.generic.type;
+
+        if (spriteBase.generic.sprite_identifier == SPRITE_IDENTIFIER_NULL
+            && spriteCmp.generic.sprite_identifier != SPRITE_IDENTIFIER_NULL)
+        {
+            // Sprite was added.
+            changeData.changeType = GameStateSpriteChange_t::ADDED;
+            changeData.spriteIdentifier = spriteCmp.generic.sprite_identifier;
+        }
+        else if (
+            spriteBase.generic.sprite_identifier != SPRITE_IDENTIFIER_NULL
+            && spriteCmp.generic.sprite_identifier == SPRITE_IDENTIFIER_NULL)
+        {
+            // Sprite was removed.
+            changeData.changeType = GameStateSpriteChange_t::REMOVED;
+            changeData.spriteIdentifier = spriteBase.generic.sprite_identifier;
+        }
+        else if (
+            spriteBase.generic.sprite_identifier == SPRITE_IDENTIFIER_NULL
+            && spriteCmp.generic.sprite_identifier == SPRITE_IDENTIFIER_NULL)
+        {
+            // Do nothing.
+            return;
+        }
+        else
+        {
+            CompareSpriteData(spriteBase, spriteCmp, changeData);
+            if (changeData.diffs.size() == 0)
+            {
+                return;
+            }
+            changeData.changeType = GameStateSpriteChange_t::MODIFIED;
+        }
+
+        res.spriteChanges.push_back(std::move(changeData));
+    }
+
     virtual GameStateCompareData_t Compare(const GameStateSnapshot_t& base, const GameStateSnapshot_t& cmp) const override final
     {
         GameStateCompareData_t res;
@@ -524,56 +782,42 @@ struct GameStateSnapshots final : public IGameStateSnapshots
         res.srand0Left = base.srand0;
         res.srand0Right = cmp.srand0;
 
-        std::vector<rct_sprite> spritesBase = BuildSpriteList(const_cast<GameStateSnapshot_t&>(base));
-        std::vector<rct_sprite> spritesCmp = BuildSpriteList(const_cast<GameStateSnapshot_t&>(cmp));
-
-        for (uint32_t i = 0; i < static_cast<uint32_t>(spritesBase.size()); i++)
-        {
-            GameStateSpriteChange_t changeData;
-            changeData.spriteIndex = i;
+        using BlockIterator = std::vector<GameStateSpriteBlock_t>::const_iterator;
+        auto getSpanEnd = [](BlockIterator begin, BlockIterator end, uint32_t span) {
+            return std::find_if(begin, end, [span](const GameStateSpriteBlock_t& b) { return b.GetSpan() != span; });
+        };
 
-            const rct_sprite& spriteBase = spritesBase[i];
-            const rct_sprite& spriteCmp = spritesCmp[i];
-
-            changeData.spriteIdentifier = spriteBase.generic.sprite_identifier;
-            changeData.miscIdentifier = spriteBase.generic.type;
+        std::vector<rct_sprite> spritesBase(SpriteBlockSpan);
+        std::vector<rct_sprite> spritesCmp(SpriteBlockSpan);
 
-            if (spriteBase.generic.sprite_identifier == SPRITE_IDENTIFIER_NULL
-                && spriteCmp.generic.sprite_identifier != SPRITE_IDENTIFIER_NULL)
-            {
-                // Sprite was added.
-                changeData.changeType = GameStateSpriteChange_t::ADDED;
-                changeData.spriteIdentifier = spriteCmp.generic.sprite_identifier;
-            }
-            else if (
-                spriteBase.generic.sprite_identifier != SPRITE_IDENTIFIER_NULL
-                && spriteCmp.generic.sprite_identifier == SPRITE_IDENTIFIER_NULL)
-            {
-                // Sprite was removed.
-                changeData.changeType = GameStateSpriteChange_t::REMOVED;
-                changeData.spriteIdentifier = spriteBase.generic.sprite_identifier;
-            }
-            else if (
-                spriteBase.generic.sprite_identifier == SPRITE_IDENTIFIER_NULL
-                && spriteCmp.generic.sprite_identifier == SPRITE_IDENTIFIER_NULL)
-            {
-                // Do nothing.
-                changeData.changeType = GameStateSpriteChange_t::EQUAL;
-            }
-            else
+        auto itBase = base.spriteBlocks.begin();
+        auto itCmp = cmp.spriteBlocks.begin();
+        while (itBase != base.spriteBlocks.end() || itCmp != cmp.spriteBlocks.end())
+        {
+            auto spanBase = itBase != base.spriteBlocks.end() ? itBase->GetSpan() : InvalidSpan;
+            auto spanCmp = itCmp != cmp.spriteBlocks.end() ? itCmp->GetSpan() : InvalidSpan;
+            auto span = std::min(spanBase, spanCmp);
+
+            auto spanBaseEnd = span == spanBase ? getSpanEnd(itBase, base.spriteBlocks.end(), span) : itBase;
+            auto spanCmpEnd = span == spanCmp ? getSpanEnd(itCmp, cmp.spriteBlocks.end(), span) : itCmp;
+
+            // Only ranges that contain a block that differs need to be compared sprite by sprite
+            bool equal = std::equal(
+                itBase, spanBaseEnd, itCmp, spanCmpEnd, [](const GameStateSpriteBlock_t& a, const GameStateSpriteBlock_t& b) {
+                    return a.key == b.key && a.hash == b.hash;
+                });
+            if (!equal)
             {
-                CompareSpriteData(spriteBase, spriteCmp, changeData);
-                if (changeData.diffs.size() == 0)
-                {
-                    changeData.changeType = GameStateSpriteChange_t::EQUAL;
-                }
-                else
+                GameStateSnapshot_t::RestoreSpan(itBase, spanBaseEnd, spritesBase.data());
+                GameStateSnapshot_t::RestoreSpan(itCmp, spanCmpEnd, spritesCmp.data());
+                for (uint32_t i = 0; i < SpriteBlockSpan; i++)
                 {
-                    changeData.changeType = GameStateSpriteChange_t::MODIFIED;
+                    CompareSprite((span * SpriteBlockSpan) + i, spritesBase[i], spritesCmp[i], res);
                 }
             }
 
-            res.spriteChanges.push_back(changeData);
+            itBase = spanBaseEnd;
+            itCmp = spanCmpEnd;
         }
 
         return res;
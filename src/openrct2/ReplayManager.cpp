@@ -11,6 +11,7 @@
 
 #include "Context.h"
 #include "Game.h"
+#include "GameState.h"
 #include "GameStateSnapshots.h"
 #include "OpenRCT2.h"
 #include "ParkImporter.h"
@@ -32,6 +33,7 @@
 #include "world/Park.h"
 #include "zlib.h"
 
+#include <algorithm>
 #include <chrono>
 #include <memory>
 #include <vector>
@@ -67,6 +69,16 @@ namespace OpenRCT2
         }
     };
 
+    /**
+     * A full copy of the park state at a specific tick, allowing playback to start part way through a replay.
+     */
+    struct ReplayKeyframe
+    {
+        uint32_t tick = 0;
+        uint64_t uncompressedSize = 0;
+        MemoryStream data; // Compressed park data, park parameters and cheats.
+    };
+
     struct ReplayRecordFile
     {
         uint32_t magic;
@@ -92,13 +104,103 @@ namespace OpenRCT2
         std::vector<std::pair<uint32_t, rct_sprite_checksum>> checksums;
         uint32_t checksumIndex;
         MemoryStream gameStateSnapshots;
+        std::vector<ReplayKeyframe> keyframes;
     };
 
+    static constexpr size_t ReplayCompressionChunkSize = 64 * 1024;
+
+    /**
+     * Deflates the input stream chunk by chunk and appends the result to output.
+     */
+    static bool CompressStream(IStream& input, MemoryStream& output, int level)
+    {
+        z_stream strm = {};
+        if (deflateInit(&strm, level) != Z_OK)
+            return false;
+
+        auto inBuf = std::make_unique<unsigned char[]>(ReplayCompressionChunkSize);
+        auto outBuf = std::make_unique<unsigned char[]>(ReplayCompressionChunkSize);
+
+        input.SetPosition(0);
+        uint64_t remaining = input.GetLength();
+        int status = Z_OK;
+        do
+        {
+            size_t chunkSize = static_cast<size_t>(std::min<uint64_t>(remaining, ReplayCompressionChunkSize));
+            input.Read(inBuf.get(), chunkSize);
+            remaining -= chunkSize;
+
+            strm.next_in = inBuf.get();
+            strm.avail_in = static_cast<uInt>(chunkSize);
+            int flush = remaining == 0 ? Z_FINISH : Z_NO_FLUSH;
+            do
+            {
+                strm.next_out = outBuf.get();
+                strm.avail_out = static_cast<uInt>(ReplayCompressionChunkSize);
+                status = deflate(&strm, flush);
+                if (status == Z_STREAM_ERROR)
+                {
+                    deflateEnd(&strm);
+                    return false;
+                }
+                output.Write(outBuf.get(), ReplayCompressionChunkSize - strm.avail_out);
+            } while (strm.avail_out == 0);
+        } while (remaining != 0);
+
+        deflateEnd(&strm);
+        return status == Z_STREAM_END;
+    }
+
+    /**
+     * Inflates compressed data that is expected to expand to exactly uncompressedSize bytes.
+     */
+    static bool DecompressStream(const void* data, uint64_t length, uint64_t uncompressedSize, MemoryStream& output)
+    {
+        z_stream strm = {};
+        if (inflateInit(&strm) != Z_OK)
+            return false;
+
+        auto outBuf = std::make_unique<unsigned char[]>(uncompressedSize);
+        const unsigned char* in = static_cast<const unsigned char*>(data);
+        uint64_t remainingIn = length;
+        uint64_t totalOut = 0;
+        int status = Z_OK;
+        while (status == Z_OK)
+        {
+            if (strm.avail_in == 0 && remainingIn != 0)
+            {
+                size_t chunkSize = static_cast<size_t>(std::min<uint64_t>(remainingIn, ReplayCompressionChunkSize));
+                strm.next_in = const_cast<unsigned char*>(in);
+                strm.avail_in = static_cast<uInt>(chunkSize);
+                in += chunkSize;
+                remainingIn -= chunkSize;
+            }
+
+            size_t outChunk = static_cast<size_t>(std::min<uint64_t>(uncompressedSize - totalOut, ReplayCompressionChunkSize));
+            strm.next_out = outBuf.get() + totalOut;
+            strm.avail_out = static_cast<uInt>(outChunk);
+            status = inflate(&strm, Z_NO_FLUSH);
+            totalOut += outChunk - strm.avail_out;
+
+            // inflate returns Z_BUF_ERROR once it can make no more progress, e.g. on truncated data.
+        }
+        inflateEnd(&strm);
+
+        if (status != Z_STREAM_END || totalOut != uncompressedSize)
+            return false;
+
+        output.Write(outBuf.get(), totalOut);
+        return true;
+    }
+
     class ReplayManager final : public IReplayManager
     {
-        static constexpr uint16_t ReplayVersion = 4;
+        static constexpr uint16_t ReplayVersion = 5;
+        static constexpr uint16_t ReplayVersionNoKeyframes = 4;
         static constexpr uint32_t ReplayMagic = 0x5243524F; // ORCR.
         static constexpr int ReplayCompressionLevel = 9;
+        static constexpr int ReplayKeyframeCompressionLevel = 6; // Keyframes are compressed while the game is running.
+        static constexpr uint32_t ReplayKeyframeTicks = 40 * 60 * 5; // Roughly every five minutes at normal speed.
         static constexpr int NormalRecordingChecksumTicks = 1;
         static constexpr int SilentRecordingChecksumTicks = 40; // Same as network server
 
@@ -156,6 +258,14 @@ namespace OpenRCT2
             if (_mode == ReplayMode::NONE)
                 return;
 
+            if ((_mode == ReplayMode::RECORDING || _mode == ReplayMode::NORMALISATION) && gCurrentTicks >= _nextKeyframeTick
+                && _currentRecording != nullptr)
+            {
+                AddKeyframe();
+
+                _nextKeyframeTick = gCurrentTicks + ReplayKeyframeTicks;
+            }
+
             if ((_mode == ReplayMode::RECORDING || _mode == ReplayMode::NORMALISATION) && gCurrentTicks == _nextChecksumTick)
             {
                 rct_sprite_checksum checksum = sprite_checksum();
@@ -216,6 +326,50 @@ namespace OpenRCT2
             snapshots->SerialiseSnapshot(snapshot, snapShotDs);
         }
 
+        void CaptureParkState(MemoryStream& parkData, MemoryStream& parkParams, MemoryStream& cheatData)
+        {
+            auto context = GetContext();
+            auto& objManager = context->GetObjectManager();
+            auto objects = objManager.GetPackableObjects();
+
+            auto s6exporter = std::make_unique<S6Exporter>();
+            s6exporter->ExportObjectsList = objects;
+            s6exporter->Export();
+            s6exporter->SaveGame(&parkData);
+
+            DataSerialiser parkParamsDs(true, parkParams);
+            SerialiseParkParameters(parkParamsDs);
+
+            DataSerialiser cheatDataDs(true, cheatData);
+            SerialiseCheats(cheatDataDs);
+        }
+
+        void AddKeyframe()
+        {
+            MemoryStream parkData;
+            MemoryStream parkParams;
+            MemoryStream cheatData;
+            CaptureParkState(parkData, parkParams, cheatData);
+
+            DataSerialiser keyframeDs(true);
+            keyframeDs << parkData;
+            keyframeDs << parkParams;
+            keyframeDs << cheatData;
+
+            auto& stream = keyframeDs.GetStream();
+
+            ReplayKeyframe keyframe;
+            keyframe.tick = gCurrentTicks;
+            keyframe.uncompressedSize = stream.GetLength();
+            if (!CompressStream(stream, keyframe.data, ReplayKeyframeCompressionLevel))
+            {
+                log_warning("Unable to compress replay keyframe at tick %u", gCurrentTicks);
+                return;
+            }
+
+            _currentRecording->keyframes.push_back(std::move(keyframe));
+        }
+
         virtual bool StartRecording(
             const std::string& name, uint32_t maxTicks /*= k_MaxReplayTicks*/, RecordType rt /*= RecordType::NORMAL*/) override
         {
@@ -240,23 +394,10 @@ namespace OpenRCT2
 
             replayData->filePath = name;
 
-            auto context = GetContext();
-            auto& objManager = context->GetObjectManager();
-            auto objects = objManager.GetPackableObjects();
-
-            auto s6exporter = std::make_unique<S6Exporter>();
-            s6exporter->ExportObjectsList = objects;
-            s6exporter->Export();
-            s6exporter->SaveGame(&replayData->parkData);
+            CaptureParkState(replayData->parkData, replayData->parkParams, replayData->cheatData);
 
             replayData->timeRecorded = std::chrono::seconds(std::time(nullptr)).count();
 
-            DataSerialiser parkParamsDs(true, replayData->parkParams);
-            SerialiseParkParameters(parkParamsDs);
-
-            DataSerialiser cheatDataDs(true, replayData->cheatData);
-            SerialiseCheats(cheatDataDs);
-
             TakeGameStateSnapshot(replayData->gameStateSnapshots);
 
             if (_mode != ReplayMode::NORMALISATION)
@@ -265,6 +406,7 @@ namespace OpenRCT2
             _currentRecording = std::move(replayData);
             _recordType = rt;
             _nextChecksumTick = gCurrentTicks + 1;
+            _nextKeyframeTick = gCurrentTicks + ReplayKeyframeTicks;
 
             return true;
         }
@@ -294,31 +436,22 @@ namespace OpenRCT2
             DataSerialiser recSerialiser(true);
             Serialise(recSerialiser, *_currentRecording);
 
-            const auto& stream = recSerialiser.GetStream();
-            unsigned long streamLength = static_cast<unsigned long>(stream.GetLength());
-            unsigned long compressLength = compressBound(streamLength);
-
-            MemoryStream data(compressLength);
+            auto& stream = recSerialiser.GetStream();
 
-            ReplayRecordFile file{ _currentRecording->magic, _currentRecording->version, streamLength, data };
+            ReplayRecordFile file{ _currentRecording->magic, _currentRecording->version, stream.GetLength(), MemoryStream() };
 
-            auto compressBuf = std::make_unique<unsigned char[]>(compressLength);
-            compress2(
-                compressBuf.get(), &compressLength, static_cast<const unsigned char*>(stream.GetData()), stream.GetLength(),
-                ReplayCompressionLevel);
-            file.data.Write(compressBuf.get(), compressLength);
+            bool result = CompressStream(stream, file.data, ReplayCompressionLevel);
 
             DataSerialiser fileSerialiser(true);
             fileSerialiser << file.magic;
             fileSerialiser << file.version;
             fileSerialiser << file.uncompressedSize;
             fileSerialiser << file.data;
-
-            bool result = false;
+            WriteKeyframes(fileSerialiser, _currentRecording->keyframes);
 
             const std::string& outFile = _currentRecording->filePath;
 
-            FILE* fp = fopen(outFile.c_str(), "wb");
+            FILE* fp = result ? fopen(outFile.c_str(), "wb") : nullptr;
             if (fp)
             {
                 const auto& fileStream = fileSerialiser.GetStream();
@@ -369,6 +502,7 @@ namespace OpenRCT2
                 info.Ticks = data->tickEnd - data->tickStart;
             info.NumCommands = static_cast<uint32_t>(data->commands.size());
             info.NumChecksums = static_cast<uint32_t>(data->checksums.size());
+            info.NumKeyframes = static_cast<uint32_t>(data->keyframes.size());
 
             return true;
         }
@@ -412,7 +546,7 @@ namespace OpenRCT2
             }
         }
 
-        virtual bool StartPlayback(const std::string& file) override
+        virtual bool StartPlayback(const std::string& file, uint32_t startTick /*= 0*/) override
         {
             if (_mode != ReplayMode::NONE && _mode != ReplayMode::NORMALISATION)
                 return false;
@@ -425,19 +559,43 @@ namespace OpenRCT2
                 return false;
             }
 
-            if (!LoadReplayDataMap(*replayData))
+            uint32_t targetTick = replayData->tickStart;
+            if (_mode != ReplayMode::NORMALISATION)
+                targetTick += std::min(startTick, replayData->tickEnd - replayData->tickStart);
+
+            const ReplayKeyframe* keyframe = FindKeyframe(*replayData, targetTick);
+            if (keyframe != nullptr)
             {
-                log_error("Unable to load map.");
-                return false;
+                if (!LoadReplayKeyframe(*replayData, *keyframe))
+                {
+                    log_error("Unable to load keyframe at tick %u.", keyframe->tick);
+                    return false;
+                }
+
+                gCurrentTicks = keyframe->tick;
+
+                // The initial snapshot does not match the state at the keyframe, only the final one is compared.
+                SkipSnapshot(replayData->gameStateSnapshots);
+                SkipToTick(*replayData, keyframe->tick);
             }
+            else
+            {
+                if (!LoadReplayDataMap(*replayData))
+                {
+                    log_error("Unable to load map.");
+                    return false;
+                }
 
-            gCurrentTicks = replayData->tickStart;
+                gCurrentTicks = replayData->tickStart;
 
-            LoadAndCompareSnapshot(replayData->gameStateSnapshots);
+                LoadAndCompareSnapshot(replayData->gameStateSnapshots);
+
+                replayData->checksumIndex = 0;
+            }
 
             _currentReplay = std::move(replayData);
-            _currentReplay->checksumIndex = 0;
             _faultyChecksumIndex = -1;
+            _mismatchTicks.clear();
 
             // Make sure game is not paused.
             gGamePaused = 0;
@@ -445,6 +603,13 @@ namespace OpenRCT2
             if (_mode != ReplayMode::NORMALISATION)
                 _mode = ReplayMode::PLAYING;
 
+            // Simulate the remaining ticks between the keyframe and the requested tick.
+            auto* gameState = GetContext()->GetGameState();
+            while (_mode == ReplayMode::PLAYING && gCurrentTicks < targetTick && gameState != nullptr)
+            {
+                gameState->UpdateLogic();
+            }
+
             return true;
         }
 
@@ -457,6 +622,11 @@ namespace OpenRCT2
             return _faultyChecksumIndex != -1;
         }
 
+        virtual const std::vector<uint32_t>& GetPlaybackMismatchTicks() const override
+        {
+            return _mismatchTicks;
+        }
+
         virtual bool StopPlayback() override
         {
             if (_mode != ReplayMode::PLAYING && _mode != ReplayMode::NORMALISATION)
@@ -482,11 +652,42 @@ namespace OpenRCT2
             return true;
         }
 
+        virtual bool LoadReplayGameActions(const std::string& file, std::vector<ReplayGameAction>& actions) override
+        {
+            if (_mode != ReplayMode::NONE)
+                return false;
+
+            auto replayData = std::make_unique<ReplayRecordData>();
+            if (!ReadReplayData(file, *replayData))
+            {
+                log_error("Unable to read replay data.");
+                return false;
+            }
+
+            if (!LoadReplayDataMap(*replayData))
+            {
+                log_error("Unable to load map.");
+                return false;
+            }
+
+            gCurrentTicks = replayData->tickStart;
+
+            actions.clear();
+            actions.reserve(replayData->commands.size());
+            for (const auto& command : replayData->commands)
+            {
+                // The action is not part of the ordering, so it can be moved out of the set.
+                auto action = std::move(const_cast<ReplayCommand&>(command).action);
+                actions.push_back({ command.tick - replayData->tickStart, std::move(action) });
+            }
+            return true;
+        }
+
         virtual bool NormaliseReplay(const std::string& file, const std::string& outFile) override
         {
             _mode = ReplayMode::NORMALISATION;
 
-            if (!StartPlayback(file))
+            if (!StartPlayback(file, 0))
             {
                 return false;
             }
@@ -553,6 +754,137 @@ namespace OpenRCT2
             return true;
         }
 
+        /**
+         * Returns the last keyframe at or before the given tick, or nullptr if playback should start from the beginning.
+         */
+        const ReplayKeyframe* FindKeyframe(const ReplayRecordData& data, uint32_t tick) const
+        {
+            auto it = std::upper_bound(
+                data.keyframes.begin(), data.keyframes.end(), tick,
+                [](uint32_t t, const ReplayKeyframe& keyframe) { return t < keyframe.tick; });
+            if (it == data.keyframes.begin())
+                return nullptr;
+            return &*std::prev(it);
+        }
+
+        bool LoadReplayKeyframe(ReplayRecordData& data, const ReplayKeyframe& keyframe)
+        {
+            MemoryStream stream;
+            if (!DecompressStream(
+                    keyframe.data.GetData(), keyframe.data.GetLength(), keyframe.uncompressedSize, stream))
+            {
+                return false;
+            }
+
+            try
+            {
+                data.parkData = MemoryStream();
+                data.parkParams = MemoryStream();
+                data.cheatData = MemoryStream();
+
+                stream.SetPosition(0);
+                DataSerialiser keyframeDs(false, stream);
+                keyframeDs << data.parkData;
+                keyframeDs << data.parkParams;
+                keyframeDs << data.cheatData;
+
+                data.parkData.SetPosition(0);
+                data.parkParams.SetPosition(0);
+                data.cheatData.SetPosition(0);
+            }
+            catch (const std::exception& ex)
+            {
+                log_error("Exception: %s", ex.what());
+                return false;
+            }
+
+            return LoadReplayDataMap(data);
+        }
+
+        /**
+         * Drops the commands and checksums that precede the given tick.
+         */
+        void SkipToTick(ReplayRecordData& data, uint32_t tick)
+        {
+            auto& commands = data.commands;
+            while (!commands.empty() && commands.begin()->tick < tick)
+            {
+                commands.erase(commands.begin());
+            }
+
+            auto it = std::lower_bound(
+                data.checksums.begin(), data.checksums.end(), tick,
+                [](const std::pair<uint32_t, rct_sprite_checksum>& checksum, uint32_t t) { return checksum.first < t; });
+            data.checksumIndex = static_cast<uint32_t>(std::distance(data.checksums.begin(), it));
+        }
+
+        void SkipSnapshot(MemoryStream& snapshotStream)
+        {
+            try
+            {
+                DataSerialiser ds(false, snapshotStream);
+
+                IGameStateSnapshots* snapshots = GetContext()->GetGameStateSnapshots();
+                GameStateSnapshot_t& replaySnapshot = snapshots->CreateSnapshot();
+                snapshots->SerialiseSnapshot(replaySnapshot, ds);
+            }
+            catch (const std::exception& err)
+            {
+                log_warning("Snapshot data failed to be read. %s", err.what());
+            }
+        }
+
+        void WriteKeyframes(DataSerialiser& serialiser, std::vector<ReplayKeyframe>& keyframes)
+        {
+            // The index comes first so a reader knows where each keyframe lives without decompressing any of them.
+            uint32_t countKeyframes = static_cast<uint32_t>(keyframes.size());
+            serialiser << countKeyframes;
+            for (auto& keyframe : keyframes)
+            {
+                uint32_t compressedSize = static_cast<uint32_t>(keyframe.data.GetLength());
+                serialiser << keyframe.tick;
+                serialiser << keyframe.uncompressedSize;
+                serialiser << compressedSize;
+            }
+            for (auto& keyframe : keyframes)
+            {
+                serialiser.GetStream().Write(keyframe.data.GetData(), keyframe.data.GetLength());
+            }
+        }
+
+        bool ReadKeyframes(MemoryStream& stream, std::vector<ReplayKeyframe>& keyframes)
+        {
+            DataSerialiser serialiser(false, stream);
+
+            uint32_t countKeyframes = 0;
+            serialiser << countKeyframes;
+
+            std::vector<uint32_t> compressedSizes(countKeyframes);
+            keyframes.resize(countKeyframes);
+            for (uint32_t i = 0; i < countKeyframes; i++)
+            {
+                serialiser << keyframes[i].tick;
+                serialiser << keyframes[i].uncompressedSize;
+                serialiser << compressedSizes[i];
+            }
+
+            for (uint32_t i = 0; i < countKeyframes; i++)
+            {
+                uint64_t position = stream.GetPosition();
+                if (position + compressedSizes[i] > stream.GetLength())
+                {
+                    log_error("Replay keyframe %u is truncated.", i);
+                    return false;
+                }
+
+                const auto* keyframeData = static_cast<const uint8_t*>(stream.GetData()) + position;
+                keyframes[i].data = MemoryStream(keyframeData, compressedSizes[i]);
+                stream.SetPosition(position + compressedSizes[i]);
+            }
+
+            return true;
+        }
+
         bool ReadReplayFromFile(const std::string& file, MemoryStream& stream)
         {
             FILE* fp = fopen(file.c_str(), "rb");
@@ -575,9 +907,10 @@ namespace OpenRCT2
         /**
          * Returns true if decompression was not needed or succeeded
          * @param stream
+         * @param keyframes receives the still compressed keyframes stored after the body
          * @return
          */
-        bool TryDecompress(MemoryStream& stream)
+        bool TryDecompress(MemoryStream& stream, std::vector<ReplayKeyframe>& keyframes)
         {
             ReplayRecordFile recFile;
             stream.SetPosition(0);
@@ -590,17 +923,19 @@ namespace OpenRCT2
                 fileSerializer << recFile.uncompressedSize;
                 fileSerializer << recFile.data;
 
-                auto buff = std::make_unique<unsigned char[]>(recFile.uncompressedSize);
-                unsigned long outSize = recFile.uncompressedSize;
-                uncompress(
-                    static_cast<unsigned char*>(buff.get()), &outSize,
-                    static_cast<const unsigned char*>(recFile.data.GetData()), recFile.data.GetLength());
-                if (outSize != recFile.uncompressedSize)
+                // Keyframes follow the compressed body and stay compressed until playback seeks to one.
+                if (recFile.version > ReplayVersionNoKeyframes && !ReadKeyframes(stream, keyframes))
                 {
                     return false;
                 }
-                stream.SetPosition(0);
-                stream.Write(buff.get(), outSize);
+
+                MemoryStream body;
+                if (!DecompressStream(
+                        recFile.data.GetData(), recFile.data.GetLength(), recFile.uncompressedSize, body))
+                {
+                    return false;
+                }
+                stream = std::move(body);
             }
 
             return true;
@@ -633,7 +968,7 @@ namespace OpenRCT2
             if (!loaded)
                 return false;
 
-            if (!TryDecompress(stream))
+            if (!TryDecompress(stream, data.keyframes))
                 return false;
 
             stream.SetPosition(0);
@@ -708,7 +1043,8 @@ namespace OpenRCT2
 
         bool Compatible(ReplayRecordData& data)
         {
-            return data.version == ReplayVersion;
+            // Keyframes are stored outside of the body, so replays without them are otherwise identical.
+            return data.version == ReplayVersion || data.version == ReplayVersionNoKeyframes;
         }
 
         bool Serialise(DataSerialiser& serialiser, ReplayRecordData& data)
@@ -806,6 +1142,7 @@ namespace OpenRCT2
                         replayTick, savedChecksum.second.ToString().c_str(), checksum.ToString().c_str());
 
                     _faultyChecksumIndex = checksumIndex;
+                    _mismatchTicks.push_back(gCurrentTicks);
                 }
                 else
                 {
@@ -870,8 +1207,10 @@ namespace OpenRCT2
         std::unique_ptr<ReplayRecordData> _currentRecording;
         std::unique_ptr<ReplayRecordData> _currentReplay;
         int32_t _faultyChecksumIndex = -1;
+        std::vector<uint32_t> _mismatchTicks;
         uint32_t _commandId = 0;
         uint32_t _nextChecksumTick = 0;
+        uint32_t _nextKeyframeTick = 0;
         uint32_t _nextReplayTick = 0;
         RecordType _recordType = RecordType::NORMAL;
     };
@@ -14,6 +14,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 struct GameAction;
 
@@ -21,6 +22,12 @@ namespace OpenRCT2
 {
     static constexpr uint32_t k_MaxReplayTicks = 0xFFFFFFFF;
 
+    struct ReplayGameAction
+    {
+        uint32_t Tick; // Relative to the start of the replay.
+        std::unique_ptr<GameAction> Action;
+    };
+
     struct ReplayRecordInfo
     {
         uint16_t Version;
@@ -28,6 +35,7 @@ namespace OpenRCT2
         uint64_t TimeRecorded;
         uint32_t NumCommands;
         uint32_t NumChecksums;
+        uint32_t NumKeyframes;
         std::string Name;
         std::string FilePath;
     };
@@ -58,10 +66,24 @@ namespace OpenRCT2
         virtual bool StopRecording(bool discard = false) = 0;
         virtual bool GetCurrentReplayInfo(ReplayRecordInfo & info) const = 0;
 
-        virtual bool StartPlayback(const std::string& file) = 0;
+        /**
+         * Starts playing back the given replay. If startTick is not zero, playback resumes that many ticks into the
+         * replay by loading the closest preceding keyframe and simulating the remaining ticks.
+         */
+        virtual bool StartPlayback(const std::string& file, uint32_t startTick = 0) = 0;
         virtual bool IsPlaybackStateMismatching() const = 0;
+        /**
+         * Returns the ticks at which the checksum did not match during the current or most recent playback.
+         */
+        virtual const std::vector<uint32_t>& GetPlaybackMismatchTicks() const = 0;
         virtual bool StopPlayback() = 0;
 
+        /**
+         * Loads the park of the given replay without starting playback and returns its game actions in order, so they
+         * can be issued by other means such as simulated network clients.
+         */
+        virtual bool LoadReplayGameActions(const std::string& file, std::vector<ReplayGameAction>& actions) = 0;
+
         virtual bool NormaliseReplay(const std::string& inputFile, const std::string& outputFile) = 0;
     };
 
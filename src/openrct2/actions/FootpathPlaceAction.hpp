@@ -43,7 +43,7 @@ public:
 
     uint16_t GetActionFlags() const override
     {
-        return GameAction::GetActionFlags();
+        return GameAction::GetActionFlags() | GA_FLAGS::CLIENT_PREDICTED;
     }
 
     void Serialise(DataSerialiser & stream) override
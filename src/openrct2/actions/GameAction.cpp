@@ -208,10 +208,18 @@ namespace GameActions
             Guard::Assert(action != nullptr);
 
             GameActionResult::Ptr result = Execute(action);
-            if (result->Error == GA_ERROR::OK && network_get_mode() == NETWORK_MODE_SERVER)
+            if (network_get_mode() == NETWORK_MODE_SERVER)
             {
-                // Relay this action to all other clients.
-                network_send_game_action(action);
+                if (result->Error == GA_ERROR::OK)
+                {
+                    // Relay this action to all other clients.
+                    network_send_game_action(action);
+                }
+                else
+                {
+                    // Let the client that sent it know, it may have predicted the result.
+                    network_send_game_action_rejected(action, result.get());
+                }
             }
 
             _actionQueue.erase(_actionQueue.begin());
@@ -257,15 +265,18 @@ namespace GameActions
     {
         std::unique_ptr<GameAction> ga = GameActions::Create(action->GetType());
         ga->SetCallback(action->GetCallback());
+        ga->SetRejectedCallback(action->GetRejectedCallback());
+
+        // The copy goes through the serialised form rather than the copy constructor so that it only carries what would
+        // reach the other players, the server executes its own actions from these copies. The buffer is reused so no
+        // memory is allocated once it has grown large enough.
+        static thread_local MemoryStream stream;
+        stream.Clear();
 
-        // Serialise action data into stream.
-        DataSerialiser dsOut(true);
+        DataSerialiser dsOut(true, stream);
         action->Serialise(dsOut);
 
-        // Serialise into new action.
-        IStream& stream = dsOut.GetStream();
         stream.SetPosition(0);
-
         DataSerialiser dsIn(false, stream);
         ga->Serialise(dsIn);
 
@@ -424,6 +435,11 @@ namespace GameActions
                         log_verbose("[%s] GameAction::Execute %s (Out)", GetRealm(), action->GetName());
                         network_send_game_action(action);
 
+                        auto cb = action->GetCallback();
+                        if (cb != nullptr && action->IsClientPredicted())
+                        {
+                            cb(action, result.get());
+                        }
                         return result;
                     }
                 }
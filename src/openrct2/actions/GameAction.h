@@ -52,6 +52,10 @@ namespace GA_FLAGS
     constexpr uint16_t ALLOW_WHILE_PAUSED = 1 << 0;
     constexpr uint16_t CLIENT_ONLY = 1 << 1;
     constexpr uint16_t EDITOR_ONLY = 1 << 2;
+    // The callback can be given the query result, so clients may report it straight away instead of waiting a round trip
+    // for the server to echo the action back. Only call sites that set a rejected callback opt in. The game state itself
+    // still only changes when the server's copy runs.
+    constexpr uint16_t CLIENT_PREDICTED = 1 << 3;
 } // namespace GA_FLAGS
 
 #ifdef __WARN_SUGGEST_FINAL_METHODS__
@@ -207,6 +211,7 @@ private:
     uint32_t _flags = 0;                  // GAME_COMMAND_FLAGS
     uint32_t _networkId = 0;
     Callback_t _callback;
+    Callback_t _rejectedCallback;
 
 public:
     GameAction(uint32_t type)
@@ -281,6 +286,32 @@ public:
         return _callback;
     }
 
+    /**
+     * Setting this opts the action into prediction if its type allows it. It is called instead of the callback when the
+     * server rejects a predicted action, the callback has already been given the predicted result so this is where
+     * anything it changed is undone.
+     */
+    void SetRejectedCallback(Callback_t cb)
+    {
+        _rejectedCallback = cb;
+    }
+
+    const Callback_t& GetRejectedCallback() const
+    {
+        return _rejectedCallback;
+    }
+
+    /**
+     * Whether a client reports the local query result to the callback when sending the action. Callers without a rejected
+     * callback, such as scripts, always get the server's result. Ghosts are never predicted as their callbacks record the
+     * element that was placed.
+     */
+    bool IsClientPredicted() const
+    {
+        return (GetActionFlags() & GA_FLAGS::CLIENT_PREDICTED) != 0 && (GetFlags() & GAME_COMMAND_FLAG_GHOST) == 0
+            && _rejectedCallback != nullptr;
+    }
+
     void SetNetworkId(uint32_t id)
     {
         _networkId = id;
@@ -18,6 +18,7 @@
 #include "../localisation/Localisation.h"
 #include "../management/NewsItem.h"
 #include "../ride/Ride.h"
+#include "../ride/TrackGraph.h"
 #include "../ui/UiContext.h"
 #include "../ui/WindowManager.h"
 #include "../world/Banner.h"
@@ -134,6 +135,7 @@ private:
     GameActionResult::Ptr DemolishRide(Ride * ride) const
     {
         money32 refundPrice = DemolishTracks();
+        track_graph_invalidate_ride(_rideIndex);
 
         ride_clear_for_construction(ride);
         ride_remove_peeps(ride);
@@ -11,6 +11,7 @@
 
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
+#include "../ride/TrackGraph.h"
 #include "GameAction.h"
 
 enum class RideSetSetting : uint8_t
@@ -245,6 +246,7 @@ public:
                 break;
             case RideSetSetting::RideType:
                 ride->type = _value;
+                track_graph_invalidate_ride(ride->id);
                 gfx_invalidate_screen();
                 break;
         }
@@ -14,6 +14,7 @@
 #include "../ride/Track.h"
 #include "../ride/TrackData.h"
 #include "../ride/TrackDesign.h"
+#include "../ride/TrackGraph.h"
 #include "../util/Util.h"
 #include "../world/MapAnimation.h"
 #include "../world/Surface.h"
@@ -717,6 +718,11 @@ public:
 
         price >>= 16;
         res->Cost = cost + ((price / 2) * 10);
+
+        if (!(GetFlags() & GAME_COMMAND_FLAG_GHOST))
+        {
+            track_graph_invalidate_ride(_rideIndex);
+        }
         return res;
     }
 };
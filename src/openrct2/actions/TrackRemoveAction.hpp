@@ -14,6 +14,7 @@
 #include "../ride/Track.h"
 #include "../ride/TrackData.h"
 #include "../ride/TrackDesign.h"
+#include "../ride/TrackGraph.h"
 #include "../util/Util.h"
 #include "../world/MapAnimation.h"
 #include "../world/Surface.h"
@@ -508,6 +509,11 @@ public:
             price *= -10;
 
         res->Cost = price;
+
+        if (!isGhost)
+        {
+            track_graph_invalidate_ride(rideIndex);
+        }
         return res;
     }
 };
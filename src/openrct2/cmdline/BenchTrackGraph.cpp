@@ -0,0 +1,201 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../Context.h"
+#    include "../OpenRCT2.h"
+#    include "../platform/platform.h"
+#    include "../ride/Ride.h"
+#    include "../ride/Track.h"
+#    include "../ride/TrackGraph.h"
+#    include "../world/Map.h"
+
+#    include <benchmark/benchmark.h>
+#    include <cstdint>
+#    include <memory>
+#    include <vector>
+
+// Long enough to go round most circuits several times.
+static constexpr int32_t MaxPiecesPerWalk = 2000;
+
+struct TrackWalkStart
+{
+    ride_id_t Ride;
+    CoordsXYZ Position;
+    track_type_t TrackType;
+};
+
+static std::vector<TrackWalkStart> get_track_walk_starts()
+{
+    std::vector<TrackWalkStart> starts;
+    for (auto& ride : GetRideManager())
+    {
+        for (StationIndex stationIndex = 0; stationIndex < MAX_STATIONS; stationIndex++)
+        {
+            if (ride.stations[stationIndex].Start.isNull())
+                continue;
+
+            auto tileElement = ride_get_station_start_track_element(&ride, stationIndex);
+            if (tileElement == nullptr)
+                continue;
+
+            starts.push_back(
+                { ride.id, ride.stations[stationIndex].GetStart(), tileElement->AsTrack()->GetTrackType() });
+        }
+    }
+    return starts;
+}
+
+// Both benchmarks move from piece to piece the way vehicle motion does, by finding the piece at the vehicle's track
+// location and then the piece after it.
+static void BM_track_block_get_next(benchmark::State& state, const std::vector<TrackWalkStart> starts)
+{
+    int64_t pieces = 0;
+    for (auto _ : state)
+    {
+        for (const auto& start : starts)
+        {
+            auto trackPos = start.Position;
+            auto trackType = start.TrackType;
+            for (int32_t i = 0; i < MaxPiecesPerWalk; i++)
+            {
+                CoordsXYE input = { trackPos, map_get_track_element_at_of_type_seq(trackPos, trackType, 0) };
+                CoordsXYE output;
+                int32_t z, direction;
+                if (input.element == nullptr || !track_block_get_next(&input, &output, &z, &direction))
+                    break;
+
+                trackPos = { output, z };
+                trackType = output.element->AsTrack()->GetTrackType();
+                pieces++;
+            }
+        }
+    }
+    state.SetItemsProcessed(pieces);
+}
+
+static void BM_track_graph_get_next(benchmark::State& state, const std::vector<TrackWalkStart> starts)
+{
+    int64_t pieces = 0;
+    for (auto _ : state)
+    {
+        for (const auto& start : starts)
+        {
+            auto trackPos = start.Position;
+            auto trackType = start.TrackType;
+            for (int32_t i = 0; i < MaxPiecesPerWalk; i++)
+            {
+                auto input = track_graph_get_piece(start.Ride, trackPos, trackType);
+                TrackGraphCursor output;
+                int32_t z, direction;
+                if (input.Element.element == nullptr || !track_graph_get_next(input, &output, &z, &direction))
+                    break;
+
+                trackPos = { output.Element, z };
+                trackType = output.Element.element->AsTrack()->GetTrackType();
+                pieces++;
+            }
+        }
+    }
+    state.SetItemsProcessed(pieces);
+}
+
+static int cmdline_for_bench_track_graph(int argc, const char** argv)
+{
+    // Google benchmark does stuff to argv. It doesn't modify the pointees,
+    // but it wants to reorder the pointers, so present a copy of them.
+    std::vector<char*> argv_for_benchmark;
+
+    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+    argv_for_benchmark.push_back(nullptr);
+
+    // The park has to stay loaded while the benchmarks run, so only the first one given is used.
+    const char* parkFileName = nullptr;
+    for (int i = 0; i < argc; i++)
+    {
+        if (parkFileName == nullptr && platform_file_exists(argv[i]))
+        {
+            parkFileName = argv[i];
+        }
+        else
+        {
+            argv_for_benchmark.push_back(const_cast<char*>(argv[i]));
+        }
+    }
+    if (parkFileName == nullptr)
+    {
+        log_error("No park given.");
+        return -1;
+    }
+
+    core_init();
+    gOpenRCT2Headless = true;
+    std::unique_ptr<OpenRCT2::IContext> context(OpenRCT2::CreateContext());
+    if (!context->Initialise())
+    {
+        log_error("Context initialization failed.");
+        return -1;
+    }
+    if (!context->LoadParkFromFile(parkFileName))
+    {
+        log_error("Failed to load park!");
+        return -1;
+    }
+
+    auto starts = get_track_walk_starts();
+    log_info("Walking from %u stations.", static_cast<uint32_t>(starts.size()));
+    benchmark::RegisterBenchmark("track_block_get_next", BM_track_block_get_next, starts);
+    benchmark::RegisterBenchmark("track_graph_get_next", BM_track_graph_get_next, starts);
+
+    // Update argc with all the changes made
+    argc = static_cast<int>(argv_for_benchmark.size());
+    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+        return -1;
+    ::benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
+
+static exitcode_t HandleBenchTrackGraph(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = cmdline_for_bench_track_graph(argc, argv);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+#else
+static exitcode_t HandleBenchTrackGraph(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark not enabled in this build");
+    return EXITCODE_FAIL;
+}
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchTrackGraphCommands[]{
+#ifdef USE_BENCHMARK
+    DefineCommand(
+        "",
+        "<file> [--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
+        "[--benchmark_repetitions=<num_repetitions>] [--benchmark_report_aggregates_only={true|false}] "
+        "[--benchmark_format=<console|json|csv>] [--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>] "
+        "[--benchmark_color={auto|true|false}] [--benchmark_counters_tabular={true|false}] [--v=<verbosity>]",
+        nullptr, HandleBenchTrackGraph),
+    CommandTableEnd
+#else
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchTrackGraph), CommandTableEnd
+#endif // USE_BENCHMARK
+};
@@ -118,7 +118,10 @@ namespace CommandLine
     extern const CommandLineCommand SpriteCommands[];
     extern const CommandLineCommand BenchGfxCommands[];
     extern const CommandLineCommand BenchSpriteSortCommands[];
+    extern const CommandLineCommand BenchTrackGraphCommands[];
     extern const CommandLineCommand SimulateCommands[];
+    extern const CommandLineCommand ReplayCommands[];
+    extern const CommandLineCommand LoadTestCommands[];
 
     extern const CommandLineExample RootExamples[];
 
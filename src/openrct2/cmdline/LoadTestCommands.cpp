@@ -0,0 +1,509 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+#    include "../Context.h"
+#    include "../Game.h"
+#    include "../GameState.h"
+#    include "../OpenRCT2.h"
+#    include "../ReplayManager.h"
+#    include "../actions/GameAction.h"
+#    include "../config/Config.h"
+#    include "../core/Console.hpp"
+#    include "../core/Json.hpp"
+#    include "../core/Path.hpp"
+#    include "../core/String.hpp"
+#    include "../network/NetworkConnection.h"
+#    include "../network/NetworkKey.h"
+#    include "../network/NetworkPacket.h"
+#    include "../network/Socket.h"
+#    include "../network/network.h"
+#    include "../platform/platform.h"
+#    include "CommandLine.hpp"
+
+#    include <algorithm>
+#    include <chrono>
+#    include <memory>
+#    include <string>
+#    include <vector>
+
+using namespace OpenRCT2;
+
+static int32_t _numClients = 8;
+static int32_t _numTicks = 4000;
+static int32_t _port = 11760;
+static int32_t _chatInterval = 400;
+static utf8* _outputPath = nullptr;
+
+// clang-format off
+static constexpr const CommandLineOptionDefinition LoadTestOptions[]
+{
+    { CMDLINE_TYPE_INTEGER, &_numClients,   'c', "clients",       "number of simulated clients, defaults to 8"           },
+    { CMDLINE_TYPE_INTEGER, &_numTicks,     't', "ticks",         "number of ticks to measure, defaults to 4000"         },
+    { CMDLINE_TYPE_INTEGER, &_port,         'p', "port",          "localhost port to host on, defaults to 11760"         },
+    { CMDLINE_TYPE_INTEGER, &_chatInterval, NAC, "chat-interval", "ticks between chat messages per client, 0 to disable" },
+    { CMDLINE_TYPE_STRING,  &_outputPath,   'o', "output",        "write the report to a file instead of stdout"         },
+    OptionTableEnd
+};
+
+static exitcode_t HandleLoadTest(CommandLineArgEnumerator* argEnumerator);
+
+const CommandLineCommand CommandLine::LoadTestCommands[]
+{
+    // Main commands
+    DefineCommand("", "<park or replay file>", LoadTestOptions, HandleLoadTest),
+    CommandTableEnd
+};
+// clang-format on
+
+// How long to wait for all clients to join before giving up.
+static constexpr auto JoinTimeout = std::chrono::seconds(60);
+static constexpr uint32_t JoinPollIntervalMs = 5;
+
+/**
+ * A minimal client that joins the server and exchanges packets with it, without loading or simulating the park.
+ */
+class LoadTestClient final
+{
+public:
+    NetworkConnection Connection;
+    std::string Name;
+    int32_t PlayerId = -1;
+    bool Joined = false;
+    bool Failed = false;
+    uint32_t LastServerTick = 0;
+    uint32_t TicksReceived = 0;
+    uint32_t ActionsSent = 0;
+    uint32_t ChatsSent = 0;
+    size_t MaxQueuedPackets = 0;
+
+    explicit LoadTestClient(std::string name)
+        : Name(std::move(name))
+    {
+    }
+
+    bool Connect(uint16_t port)
+    {
+        if (!_key.Generate())
+        {
+            Console::Error::WriteLine("%s: unable to generate key.", Name.c_str());
+            return false;
+        }
+
+        try
+        {
+            Connection.Socket = CreateTcpSocket();
+            Connection.Socket->Connect("127.0.0.1", port);
+        }
+        catch (const std::exception& ex)
+        {
+            Console::Error::WriteLine("%s: %s", Name.c_str(), ex.what());
+            return false;
+        }
+
+        std::unique_ptr<NetworkPacket> packet(NetworkPacket::Allocate());
+        *packet << static_cast<uint32_t>(NETWORK_COMMAND_TOKEN);
+        Connection.AuthStatus = NETWORK_AUTH_REQUESTED;
+        Connection.QueuePacket(std::move(packet));
+        return true;
+    }
+
+    void Update()
+    {
+        if (Failed)
+            return;
+
+        int32_t packetStatus;
+        do
+        {
+            packetStatus = Connection.ReadPacket();
+            if (packetStatus == NETWORK_READPACKET_DISCONNECTED)
+            {
+                Console::Error::WriteLine("%s: disconnected by the server.", Name.c_str());
+                Failed = true;
+                return;
+            }
+            if (packetStatus == NETWORK_READPACKET_SUCCESS)
+            {
+                ProcessPacket(Connection.InboundPacket);
+                Connection.InboundPacket.Clear();
+            }
+        } while (packetStatus == NETWORK_READPACKET_MORE_DATA || packetStatus == NETWORK_READPACKET_SUCCESS);
+    }
+
+    void SendGameAction(const GameAction& action)
+    {
+        std::unique_ptr<NetworkPacket> packet(NetworkPacket::Allocate());
+        *packet << static_cast<uint32_t>(NETWORK_COMMAND_GAME_ACTION) << LastServerTick << action.GetType();
+        NetworkPacketStream stream(*packet);
+        DataSerialiser ds(true, stream);
+        action.Serialise(ds);
+        Connection.QueuePacket(std::move(packet));
+        ActionsSent++;
+    }
+
+    void SendChat(const std::string& text)
+    {
+        std::unique_ptr<NetworkPacket> packet(NetworkPacket::Allocate());
+        *packet << static_cast<uint32_t>(NETWORK_COMMAND_CHAT);
+        packet->WriteString(text.c_str());
+        Connection.QueuePacket(std::move(packet));
+        ChatsSent++;
+    }
+
+private:
+    NetworkKey _key;
+
+    void ProcessPacket(NetworkPacket& packet)
+    {
+        uint32_t command;
+        packet >> command;
+        switch (command)
+        {
+            case NETWORK_COMMAND_TOKEN:
+                HandleToken(packet);
+                break;
+            case NETWORK_COMMAND_AUTH:
+                HandleAuth(packet);
+                break;
+            case NETWORK_COMMAND_OBJECTS:
+            {
+                // The map is not loaded, so no objects are needed.
+                std::unique_ptr<NetworkPacket> reply(NetworkPacket::Allocate());
+                *reply << static_cast<uint32_t>(NETWORK_COMMAND_OBJECTS) << static_cast<uint32_t>(0);
+                Connection.QueuePacket(std::move(reply));
+                break;
+            }
+            case NETWORK_COMMAND_MAP:
+            {
+                uint32_t size, offset;
+                packet >> size >> offset;
+                if (offset + (packet.Size - packet.BytesRead) >= size)
+                {
+                    Joined = true;
+                }
+                break;
+            }
+            case NETWORK_COMMAND_TICK:
+                packet >> LastServerTick;
+                TicksReceived++;
+                break;
+            case NETWORK_COMMAND_PING:
+            {
+                std::unique_ptr<NetworkPacket> reply(NetworkPacket::Allocate());
+                *reply << static_cast<uint32_t>(NETWORK_COMMAND_PING);
+                Connection.QueuePacket(std::move(reply));
+                break;
+            }
+        }
+    }
+
+    void HandleToken(NetworkPacket& packet)
+    {
+        uint32_t challengeSize;
+        packet >> challengeSize;
+        const uint8_t* challenge = packet.Read(challengeSize);
+        std::vector<uint8_t> signature;
+        if (challenge == nullptr || !_key.Sign(challenge, challengeSize, signature))
+        {
+            Console::Error::WriteLine("%s: unable to sign the server's challenge.", Name.c_str());
+            Failed = true;
+            return;
+        }
+
+        std::unique_ptr<NetworkPacket> reply(NetworkPacket::Allocate());
+        *reply << static_cast<uint32_t>(NETWORK_COMMAND_AUTH);
+        reply->WriteString(network_get_version().c_str());
+        reply->WriteString(Name.c_str());
+        reply->WriteString("");
+        reply->WriteString(_key.PublicKeyString().c_str());
+        *reply << static_cast<uint32_t>(signature.size());
+        reply->Write(signature.data(), signature.size());
+        Connection.QueuePacket(std::move(reply));
+    }
+
+    void HandleAuth(NetworkPacket& packet)
+    {
+        uint32_t authStatus;
+        uint8_t playerId;
+        packet >> authStatus >> playerId;
+        if (authStatus != NETWORK_AUTH_OK)
+        {
+            Console::Error::WriteLine("%s: authentication failed (%u).", Name.c_str(), authStatus);
+            Failed = true;
+            return;
+        }
+        Connection.AuthStatus = NETWORK_AUTH_OK;
+        PlayerId = playerId;
+
+        // Let the client run any action, as the replayed actions would otherwise mostly be refused.
+        int32_t playerIndex = network_get_player_index(playerId);
+        int32_t groupIndex = network_get_group_index(0);
+        if (playerIndex != -1 && groupIndex != -1)
+        {
+            network_set_player_group(playerIndex, groupIndex);
+        }
+    }
+};
+
+struct TickTimes
+{
+    std::vector<uint64_t> Microseconds;
+
+    uint64_t GetPercentile(double percentile) const
+    {
+        if (Microseconds.empty())
+            return 0;
+
+        auto sorted = Microseconds;
+        std::sort(sorted.begin(), sorted.end());
+        size_t index = std::min(static_cast<size_t>(percentile * sorted.size()), sorted.size() - 1);
+        return sorted[index];
+    }
+
+    double GetMean() const
+    {
+        if (Microseconds.empty())
+            return 0;
+
+        uint64_t total = 0;
+        for (auto time : Microseconds)
+        {
+            total += time;
+        }
+        return static_cast<double>(total) / Microseconds.size();
+    }
+};
+
+static void UpdateClients(std::vector<std::unique_ptr<LoadTestClient>>& clients)
+{
+    for (auto& client : clients)
+    {
+        client->Update();
+        client->Connection.SendQueuedPackets();
+    }
+}
+
+static json_t* CreateReport(
+    const std::vector<std::unique_ptr<LoadTestClient>>& clients, const TickTimes& tickTimes, double elapsedSeconds)
+{
+    json_t* jsonTicks = json_object();
+    json_object_set_new(jsonTicks, "count", json_integer(tickTimes.Microseconds.size()));
+    json_object_set_new(jsonTicks, "mean_us", json_real(tickTimes.GetMean()));
+    json_object_set_new(jsonTicks, "p50_us", json_integer(tickTimes.GetPercentile(0.5)));
+    json_object_set_new(jsonTicks, "p99_us", json_integer(tickTimes.GetPercentile(0.99)));
+    json_object_set_new(jsonTicks, "max_us", json_integer(tickTimes.GetPercentile(1.0)));
+
+    auto stats = network_get_stats();
+    json_t* jsonCommands = json_object();
+    for (size_t i = 0; i < NETWORK_COMMAND_MAX; i++)
+    {
+        if (stats.commandPacketsSent[i] == 0 && stats.commandPacketsReceived[i] == 0)
+            continue;
+
+        json_t* jsonCommand = json_object();
+        json_object_set_new(jsonCommand, "bytes_sent", json_integer(stats.commandBytesSent[i]));
+        json_object_set_new(jsonCommand, "bytes_received", json_integer(stats.commandBytesReceived[i]));
+        json_object_set_new(jsonCommand, "packets_sent", json_integer(stats.commandPacketsSent[i]));
+        json_object_set_new(jsonCommand, "packets_received", json_integer(stats.commandPacketsReceived[i]));
+        json_object_set_new(jsonCommand, "bytes_sent_per_second", json_real(stats.commandBytesSent[i] / elapsedSeconds));
+        json_object_set_new(jsonCommands, NetworkCommandNames[i], jsonCommand);
+    }
+
+    json_t* jsonClients = json_array();
+    for (const auto& client : clients)
+    {
+        json_t* jsonClient = json_object();
+        json_object_set_new(jsonClient, "name", json_string(client->Name.c_str()));
+        json_object_set_new(jsonClient, "connected", json_boolean(!client->Failed));
+        json_object_set_new(jsonClient, "ticks_received", json_integer(client->TicksReceived));
+        // A client that never received a tick has no server tick to compare with.
+        json_object_set_new(
+            jsonClient, "ticks_behind",
+            client->TicksReceived != 0 ? json_integer(gCurrentTicks - client->LastServerTick) : json_null());
+        json_object_set_new(jsonClient, "actions_sent", json_integer(client->ActionsSent));
+        json_object_set_new(jsonClient, "chats_sent", json_integer(client->ChatsSent));
+        json_object_set_new(jsonClient, "max_server_queued_packets", json_integer(client->MaxQueuedPackets));
+        auto bytesReceived = client->Connection.Stats.bytesReceived[NETWORK_STATISTICS_GROUP_TOTAL];
+        json_object_set_new(jsonClient, "bytes_received", json_integer(bytesReceived));
+        json_array_append_new(jsonClients, jsonClient);
+    }
+
+    json_t* jsonReport = json_object();
+    json_object_set_new(jsonReport, "elapsed_seconds", json_real(elapsedSeconds));
+    json_object_set_new(jsonReport, "tick_time", jsonTicks);
+    json_object_set_new(jsonReport, "commands", jsonCommands);
+    json_object_set_new(jsonReport, "clients", jsonClients);
+    return jsonReport;
+}
+
+static exitcode_t HandleLoadTest(CommandLineArgEnumerator* argEnumerator)
+{
+    const char* inputPath;
+    if (!argEnumerator->TryPopString(&inputPath))
+    {
+        Console::Error::WriteLine("Expected a park or replay file.");
+        return EXITCODE_FAIL;
+    }
+
+    // Player ids are a single byte and the host takes one.
+    if (_numClients < 1 || _numClients > 254)
+    {
+        Console::Error::WriteLine("The number of clients must be between 1 and 254.");
+        return EXITCODE_FAIL;
+    }
+
+    core_init();
+
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    // Game actions recorded in a replay are sent by the clients, spread across them in turn.
+    std::vector<ReplayGameAction> actions;
+    if (String::Equals(Path::GetExtension(inputPath), ".sv6r", true))
+    {
+        if (!context->GetReplayManager()->LoadReplayGameActions(inputPath, actions))
+        {
+            Console::Error::WriteLine("Unable to load replay '%s'.", inputPath);
+            return EXITCODE_FAIL;
+        }
+    }
+    else if (!context->LoadParkFromFile(inputPath))
+    {
+        return EXITCODE_FAIL;
+    }
+
+    // Only change the settings in memory, the configuration file is left untouched.
+    gConfigNetwork.maxplayers = _numClients + 1;
+    gConfigNetwork.known_keys_only = false;
+    gConfigNetwork.advertise = false;
+    if (!network_begin_server(_port, "127.0.0.1"))
+    {
+        Console::Error::WriteLine("Unable to start the server on port %d.", _port);
+        return EXITCODE_FAIL;
+    }
+
+    auto gameState = context->GetGameState();
+    std::vector<std::unique_ptr<LoadTestClient>> clients;
+    for (int32_t i = 0; i < _numClients; i++)
+    {
+        auto client = std::make_unique<LoadTestClient>(String::StdFormat("loadtest-%d", i + 1));
+        if (!client->Connect(static_cast<uint16_t>(_port)))
+        {
+            network_close();
+            return EXITCODE_FAIL;
+        }
+        clients.push_back(std::move(client));
+    }
+
+    // Only the network is pumped while the clients join so that the park is still at its loaded tick when the
+    // measurement starts.
+    Console::WriteLine("Waiting for %d clients to join...", _numClients);
+    auto joinStartTime = std::chrono::steady_clock::now();
+    for (;;)
+    {
+        UpdateClients(clients);
+        network_update();
+        network_process_pending();
+        network_flush();
+        network_wait_for_activity(JoinPollIntervalMs);
+
+        auto isJoined = [](const auto& client) { return client->Joined || client->Failed; };
+        if (std::all_of(clients.begin(), clients.end(), isJoined))
+            break;
+
+        if (std::chrono::steady_clock::now() - joinStartTime > JoinTimeout)
+        {
+            Console::Error::WriteLine("Timed out waiting for clients to join.");
+            network_close();
+            return EXITCODE_FAIL;
+        }
+    }
+
+    Console::WriteLine("Running %d ticks with %zu game actions...", _numTicks, actions.size());
+    TickTimes tickTimes;
+    tickTimes.Microseconds.reserve(_numTicks);
+    size_t nextAction = 0;
+    auto startTime = std::chrono::steady_clock::now();
+    for (int32_t tick = 0; tick < _numTicks; tick++)
+    {
+        UpdateClients(clients);
+
+        for (; nextAction < actions.size() && actions[nextAction].Tick <= static_cast<uint32_t>(tick); nextAction++)
+        {
+            auto& client = clients[nextAction % clients.size()];
+            if (!client->Failed)
+            {
+                client->SendGameAction(*actions[nextAction].Action);
+            }
+        }
+
+        if (_chatInterval > 0)
+        {
+            for (size_t i = 0; i < clients.size(); i++)
+            {
+                // Stagger the messages so the clients do not all chat on the same tick.
+                auto& client = clients[i];
+                if (!client->Failed && (tick + i) % _chatInterval == 0)
+                {
+                    client->SendChat(String::StdFormat("Load test message %u", client->ChatsSent + 1));
+                }
+            }
+        }
+
+        for (auto& client : clients)
+        {
+            client->Connection.SendQueuedPackets();
+        }
+
+        auto tickStartTime = std::chrono::steady_clock::now();
+        gameState->UpdateLogic();
+        auto tickTime = std::chrono::steady_clock::now() - tickStartTime;
+        tickTimes.Microseconds.push_back(std::chrono::duration_cast<std::chrono::microseconds>(tickTime).count());
+
+        for (auto& client : clients)
+        {
+            if (client->PlayerId != -1)
+            {
+                size_t queuedPackets = network_get_player_queued_packet_count(client->PlayerId);
+                client->MaxQueuedPackets = std::max(client->MaxQueuedPackets, queuedPackets);
+            }
+        }
+    }
+    UpdateClients(clients);
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime);
+
+    json_t* jsonReport = CreateReport(clients, tickTimes, std::max(elapsed.count(), 0.001));
+    if (String::IsNullOrEmpty(_outputPath))
+    {
+        char* reportText = json_dumps(jsonReport, JSON_INDENT(4) | JSON_PRESERVE_ORDER);
+        Console::WriteLine("%s", reportText);
+        free(reportText);
+    }
+    else
+    {
+        Json::WriteToFile(_outputPath, jsonReport, JSON_INDENT(4) | JSON_PRESERVE_ORDER);
+    }
+    json_decref(jsonReport);
+
+    network_close();
+
+    auto hasFailed = [](const auto& client) { return client->Failed; };
+    return std::any_of(clients.begin(), clients.end(), hasFailed) ? EXITCODE_FAIL : EXITCODE_OK;
+}
+
+#endif // DISABLE_NETWORK
@@ -0,0 +1,342 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../GameState.h"
+#include "../OpenRCT2.h"
+#include "../ReplayManager.h"
+#include "../core/Console.hpp"
+#include "../core/File.h"
+#include "../core/FileScanner.h"
+#include "../core/JobPool.hpp"
+#include "../core/Path.hpp"
+#include "../core/String.hpp"
+#include "../platform/Platform2.h"
+#include "../platform/platform.h"
+#include "CommandLine.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#    define popen _popen
+#    define pclose _pclose
+#endif
+
+using namespace OpenRCT2;
+
+// Prefix of the line a worker process prints to report its result back to the verifier.
+static constexpr const char* ReplayResultPrefix = "replay-result";
+
+static int32_t _jobs = 0;
+
+// clang-format off
+static constexpr const CommandLineOptionDefinition ReplayOptions[]
+{
+    { CMDLINE_TYPE_INTEGER, &_jobs, 'j', "jobs", "number of replays to verify in parallel, defaults to the number of cores" },
+    OptionTableEnd
+};
+
+static exitcode_t HandleReplayVerify(CommandLineArgEnumerator* argEnumerator);
+static exitcode_t HandleReplayRun(CommandLineArgEnumerator* argEnumerator);
+
+const CommandLineCommand CommandLine::ReplayCommands[]
+{
+    // Main commands
+    DefineCommand("verify", "<replay file or directory>", ReplayOptions, HandleReplayVerify),
+    DefineCommand("run",    "<replay file>",              nullptr,       HandleReplayRun   ),
+    CommandTableEnd
+};
+// clang-format on
+
+struct ReplayVerifyResult
+{
+    std::string FilePath;
+    bool Completed = false;
+    uint32_t Ticks = 0;
+    uint64_t Milliseconds = 0;
+    std::vector<uint32_t> MismatchTicks;
+};
+
+static std::vector<std::string> GetReplayFiles(const std::string& path)
+{
+    std::vector<std::string> files;
+    if (!Path::DirectoryExists(path))
+    {
+        files.push_back(path);
+        return files;
+    }
+
+    auto pattern = Path::Combine(path, "*.sv6r");
+    auto scanner = std::unique_ptr<IFileScanner>(Path::ScanDirectory(pattern, true));
+    while (scanner->Next())
+    {
+        files.push_back(scanner->GetPath());
+    }
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+#ifdef _WIN32
+/**
+ * Quotes an argument the way CommandLineToArgvW splits it, then escapes every character that cmd.exe, which popen runs
+ * the command with, would otherwise interpret.
+ */
+static std::string QuoteArgument(const std::string& arg)
+{
+    std::string quoted = "\"";
+    size_t numBackslashes = 0;
+    for (auto c : arg)
+    {
+        if (c == '\\')
+        {
+            numBackslashes++;
+        }
+        else
+        {
+            // Backslashes only need escaping when they come before a quote.
+            if (c == '"')
+            {
+                quoted.append(numBackslashes + 1, '\\');
+            }
+            numBackslashes = 0;
+        }
+        quoted += c;
+    }
+    quoted.append(numBackslashes, '\\');
+    quoted += '"';
+
+    std::string escaped;
+    for (auto c : quoted)
+    {
+        if (std::strchr("()%!^\"<>&|", c) != nullptr)
+        {
+            escaped += '^';
+        }
+        escaped += c;
+    }
+    return escaped;
+}
+#else
+/**
+ * Wraps an argument in single quotes, inside which the shell that popen runs interprets nothing but the closing quote.
+ */
+static std::string QuoteArgument(const std::string& arg)
+{
+    std::string quoted = "'";
+    for (auto c : arg)
+    {
+        if (c == '\'')
+        {
+            quoted += "'\\''";
+        }
+        else
+        {
+            quoted += c;
+        }
+    }
+    quoted += '\'';
+    return quoted;
+}
+#endif
+
+/**
+ * Builds the command line for a worker process, forwarding any custom data paths so the worker loads the same objects.
+ */
+static std::string GetWorkerCommand(const std::string& replayFile)
+{
+    std::string command = QuoteArgument(Platform::GetCurrentExecutablePath());
+    if (!String::IsNullOrEmpty(gCustomUserDataPath))
+        command += " --user-data-path=" + QuoteArgument(gCustomUserDataPath);
+    if (!String::IsNullOrEmpty(gCustomOpenRCT2DataPath))
+        command += " --openrct2-data-path=" + QuoteArgument(gCustomOpenRCT2DataPath);
+    if (!String::IsNullOrEmpty(gCustomRCT1DataPath))
+        command += " --rct1-data-path=" + QuoteArgument(gCustomRCT1DataPath);
+    if (!String::IsNullOrEmpty(gCustomRCT2DataPath))
+        command += " --rct2-data-path=" + QuoteArgument(gCustomRCT2DataPath);
+    command += " replay run " + QuoteArgument(replayFile);
+    return command;
+}
+
+static void ParseWorkerResult(const std::string& line, ReplayVerifyResult& result)
+{
+    std::istringstream iss(line.substr(String::LengthOf(ReplayResultPrefix)));
+    uint32_t numMismatches = 0;
+    if (!(iss >> result.Ticks >> result.Milliseconds >> numMismatches))
+        return;
+
+    result.MismatchTicks.resize(numMismatches);
+    for (auto& tick : result.MismatchTicks)
+    {
+        iss >> tick;
+    }
+    result.Completed = !iss.fail();
+}
+
+static ReplayVerifyResult RunWorker(const std::string& replayFile)
+{
+    ReplayVerifyResult result;
+    result.FilePath = replayFile;
+
+    auto command = GetWorkerCommand(replayFile);
+    FILE* fp = popen(command.c_str(), "r");
+    if (fp == nullptr)
+    {
+        return result;
+    }
+
+    char buffer[1024];
+    while (fgets(buffer, sizeof(buffer), fp) != nullptr)
+    {
+        if (String::StartsWith(buffer, ReplayResultPrefix))
+        {
+            ParseWorkerResult(buffer, result);
+        }
+    }
+    pclose(fp);
+    return result;
+}
+
+static exitcode_t HandleReplayVerify(CommandLineArgEnumerator* argEnumerator)
+{
+    const char* path;
+    if (!argEnumerator->TryPopString(&path))
+    {
+        Console::Error::WriteLine("Expected a replay file or directory.");
+        return EXITCODE_FAIL;
+    }
+
+    auto files = GetReplayFiles(path);
+    if (files.empty())
+    {
+        Console::Error::WriteLine("No replays found in '%s'.", path);
+        return EXITCODE_FAIL;
+    }
+
+    // Each replay runs in its own process as the game state is global, the pool only limits how many run at once.
+    size_t numCores = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    size_t numJobs = _jobs > 0 ? std::min<size_t>(_jobs, numCores) : numCores;
+    Console::WriteLine("Verifying %zu replays using %zu jobs...", files.size(), numJobs);
+
+    std::vector<ReplayVerifyResult> results(files.size());
+    std::mutex outputMutex;
+    auto startTime = std::chrono::steady_clock::now();
+    {
+        JobPool jobPool(numJobs);
+        for (size_t i = 0; i < files.size(); i++)
+        {
+            jobPool.AddTask([&files, &results, &outputMutex, i]() {
+                auto& result = results[i];
+                result = RunWorker(files[i]);
+
+                std::lock_guard<std::mutex> lock(outputMutex);
+                if (!result.Completed)
+                {
+                    Console::WriteLine("ERROR %s: replay could not be run", result.FilePath.c_str());
+                }
+                else if (!result.MismatchTicks.empty())
+                {
+                    std::string ticks;
+                    for (auto tick : result.MismatchTicks)
+                    {
+                        if (!ticks.empty())
+                            ticks += ", ";
+                        ticks += std::to_string(tick);
+                    }
+                    Console::WriteLine("FAIL  %s: mismatching ticks %s", result.FilePath.c_str(), ticks.c_str());
+                }
+                else
+                {
+                    double ticksPerSecond = result.Ticks * 1000.0 / std::max<uint64_t>(result.Milliseconds, 1);
+                    Console::WriteLine(
+                        "OK    %s: %u ticks in %" PRIu64 " ms (%.0f ticks/sec)", result.FilePath.c_str(), result.Ticks,
+                        result.Milliseconds, ticksPerSecond);
+                }
+            });
+        }
+        jobPool.Join();
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+
+    size_t numFailed = 0;
+    uint64_t totalTicks = 0;
+    for (const auto& result : results)
+    {
+        if (!result.Completed || !result.MismatchTicks.empty())
+            numFailed++;
+        totalTicks += result.Ticks;
+    }
+
+    double elapsedMs = static_cast<double>(std::max<int64_t>(elapsed.count(), 1));
+    Console::WriteLine(
+        "%zu of %zu replays passed, %" PRIu64 " ticks in %.1f s (%.0f ticks/sec)", files.size() - numFailed, files.size(),
+        totalTicks, elapsedMs / 1000.0, totalTicks * 1000.0 / elapsedMs);
+
+    return numFailed == 0 ? EXITCODE_OK : EXITCODE_FAIL;
+}
+
+static exitcode_t HandleReplayRun(CommandLineArgEnumerator* argEnumerator)
+{
+    const char* replayFile;
+    if (!argEnumerator->TryPopString(&replayFile))
+    {
+        Console::Error::WriteLine("Expected a replay file.");
+        return EXITCODE_FAIL;
+    }
+
+    core_init();
+
+    // Only the game logic is run, nothing is drawn and no sound is played.
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    auto gameState = context->GetGameState();
+    auto replayManager = context->GetReplayManager();
+    if (!replayManager->StartPlayback(replayFile))
+    {
+        Console::Error::WriteLine("Unable to start playback of '%s'.", replayFile);
+        return EXITCODE_FAIL;
+    }
+
+    uint32_t numTicks = 0;
+    auto startTime = std::chrono::steady_clock::now();
+    while (replayManager->IsReplaying())
+    {
+        gameState->UpdateLogic();
+        numTicks++;
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+
+    const auto& mismatchTicks = replayManager->GetPlaybackMismatchTicks();
+    std::string line = String::StdFormat(
+        "%s %u %" PRId64 " %zu", ReplayResultPrefix, numTicks, static_cast<int64_t>(elapsed.count()), mismatchTicks.size());
+    for (auto tick : mismatchTicks)
+    {
+        line += " " + std::to_string(tick);
+    }
+    Console::WriteLine("%s", line.c_str());
+
+    return mismatchTicks.empty() ? EXITCODE_OK : EXITCODE_FAIL;
+}
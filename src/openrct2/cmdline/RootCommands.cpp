@@ -140,7 +140,12 @@ const CommandLineCommand CommandLine::RootCommands[]
     DefineSubCommand("sprite",          CommandLine::SpriteCommands           ),
     DefineSubCommand("benchgfx",        CommandLine::BenchGfxCommands         ),
     DefineSubCommand("benchspritesort", CommandLine::BenchSpriteSortCommands  ),
+    DefineSubCommand("benchtrackgraph", CommandLine::BenchTrackGraphCommands  ),
     DefineSubCommand("simulate",        CommandLine::SimulateCommands         ),
+    DefineSubCommand("replay",          CommandLine::ReplayCommands           ),
+#ifndef DISABLE_NETWORK
+    DefineSubCommand("loadtest",        CommandLine::LoadTestCommands         ),
+#endif
     CommandTableEnd
 };
 
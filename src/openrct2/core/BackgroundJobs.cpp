@@ -0,0 +1,89 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "BackgroundJobs.h"
+
+#include "../Diagnostic.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace BackgroundJobs
+{
+    constexpr auto IDLE_TIMEOUT = std::chrono::seconds(30);
+
+    class Pool
+    {
+    private:
+        std::mutex _mutex;
+        std::condition_variable _condPending;
+        std::deque<std::function<void()>> _pending;
+        size_t _numThreads = 0;
+        size_t _numIdle = 0;
+
+    public:
+        void Add(std::function<void()> job)
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _pending.push_back(std::move(job));
+            if (_pending.size() > _numIdle && _numThreads < MAX_THREADS)
+            {
+                _numThreads++;
+                std::thread(&Pool::ProcessQueue, this).detach();
+            }
+            else
+            {
+                _condPending.notify_one();
+            }
+        }
+
+    private:
+        void ProcessQueue()
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            for (;;)
+            {
+                _numIdle++;
+                bool hasJob = _condPending.wait_for(lock, IDLE_TIMEOUT, [this] { return !_pending.empty(); });
+                _numIdle--;
+                if (!hasJob)
+                {
+                    _numThreads--;
+                    return;
+                }
+
+                auto job = std::move(_pending.front());
+                _pending.pop_front();
+                lock.unlock();
+                try
+                {
+                    job();
+                }
+                catch (const std::exception& e)
+                {
+                    log_error("Background job failed: %s", e.what());
+                }
+                lock.lock();
+            }
+        }
+    };
+
+    void Run(std::function<void()> job, Kind kind)
+    {
+        // Never destroyed, a thread may still be blocked in a system call when the process exits.
+        static Pool* generalPool = new Pool();
+        static Pool* connectPool = new Pool();
+        auto pool = kind == Kind::Connect ? connectPool : generalPool;
+        pool->Add(std::move(job));
+    }
+} // namespace BackgroundJobs
@@ -0,0 +1,36 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+/**
+ * A process wide pool of threads for blocking I/O such as resolving host names, connecting sockets, LAN discovery
+ * and HTTP requests. Threads are started on demand up to a fixed limit and stop again once they have been idle for
+ * a while, further jobs wait in a queue until a thread becomes free. Each kind of job has its own threads and queue so
+ * that slow HTTP requests cannot hold up connecting to a server.
+ *
+ * Jobs must not wait on the completion of other background jobs as that can exhaust the pool. Unlike JobPool there is
+ * no Join, jobs report back through whatever mechanism the caller prefers (promises, callbacks, atomics).
+ */
+namespace BackgroundJobs
+{
+    enum class Kind
+    {
+        General,
+        Connect,
+    };
+
+    // Per kind of job.
+    constexpr size_t MAX_THREADS = 8;
+
+    void Run(std::function<void()> job, Kind kind = Kind::General);
+} // namespace BackgroundJobs
@@ -14,38 +14,49 @@
 #include "File.h"
 #include "FileScanner.h"
 #include "FileStream.hpp"
+#include "FileWatcher.h"
 #include "JobPool.hpp"
 #include "Path.hpp"
 
+#include <atomic>
 #include <chrono>
 #include <list>
+#include <memory>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 template<typename TItem> class FileIndex
 {
 private:
-    struct DirectoryStats
-    {
-        uint32_t TotalFiles = 0;
-        uint64_t TotalFileSize = 0;
-        uint32_t FileDateModifiedChecksum = 0;
-        uint32_t PathChecksum = 0;
-    };
-
-    struct ScanResult
+    /**
+     * The size and modification date of a file at the time it was scanned. An indexed item is only
+     * recreated if the stamp of its file no longer matches the one stored in the index file.
+     */
+    struct FileStamp
     {
-        DirectoryStats const Stats;
-        std::vector<std::string> const Files;
+        std::string Path;
+        uint64_t Size = 0;
+        uint64_t LastModified = 0;
 
-        ScanResult(DirectoryStats stats, std::vector<std::string> files)
-            : Stats(stats)
-            , Files(files)
+        bool Matches(const FileStamp& other) const
         {
+            return Size == other.Size && LastModified == other.LastModified;
         }
     };
 
+    /**
+     * A scanned file and the item created from it, if the file could be indexed.
+     * Files that fail to index are kept as well so that they are not reloaded on every refresh.
+     */
+    struct IndexedFile
+    {
+        FileStamp Stamp;
+        bool HasItem = false;
+        TItem Item{};
+    };
+
     struct FileIndexHeader
     {
         uint32_t HeaderSize = sizeof(FileIndexHeader);
@@ -53,12 +64,11 @@ private:
         uint8_t VersionA = 0;
         uint8_t VersionB = 0;
         uint16_t LanguageId = 0;
-        DirectoryStats Stats;
-        uint32_t NumItems = 0;
+        uint32_t NumFiles = 0;
     };
 
     // Index file format version which when incremented forces a rebuild
-    static constexpr uint8_t FILE_INDEX_VERSION = 4;
+    static constexpr uint8_t FILE_INDEX_VERSION = 5;
 
     std::string const _name;
     uint32_t const _magicNumber;
@@ -66,6 +76,9 @@ private:
     std::string const _indexPath;
     std::string const _pattern;
 
+    std::atomic_bool _pendingChanges = { false };
+    std::vector<std::unique_ptr<FileWatcher>> _watchers;
+
 public:
     std::vector<std::string> const SearchPaths;
 
@@ -94,32 +107,90 @@ public:
     virtual ~FileIndex() = default;
 
     /**
-     * Queries and directories and loads the index header. If the index is up to date,
-     * the items are loaded from the index and returned, otherwise the index is rebuilt.
+     * Queries the directories and loads the index file. Items whose file is unchanged since the index
+     * was written are loaded from the index, new or modified files are indexed again and items of
+     * removed files are dropped. The index file is rewritten if anything changed.
      */
     std::vector<TItem> LoadOrBuild(int32_t language) const
     {
-        std::vector<TItem> items;
-        auto scanResult = Scan();
-        auto readIndexResult = ReadIndexFile(language, scanResult.Stats);
-        if (std::get<0>(readIndexResult))
+        auto files = Scan();
+        auto indexedFiles = ReadIndexFile(language);
+
+        // Keep the scan order so that items from earlier search paths still take precedence
+        std::vector<IndexedFile> result(files.size());
+        std::vector<size_t> resultIndices;
+        std::vector<FileStamp> filesToBuild;
+        for (size_t i = 0; i < files.size(); i++)
         {
-            // Index was loaded
-            items = std::get<1>(readIndexResult);
+            auto& file = files[i];
+            auto it = indexedFiles.find(file.Path);
+            if (it != indexedFiles.end() && it->second.Stamp.Matches(file))
+            {
+                result[i] = std::move(it->second);
+                indexedFiles.erase(it);
+            }
+            else
+            {
+                resultIndices.push_back(i);
+                filesToBuild.push_back(std::move(file));
+            }
         }
-        else
+
+        // Anything left in the index has either been removed or modified
+        if (!filesToBuild.empty() || !indexedFiles.empty())
         {
-            // Index was not loaded
-            items = Build(language, scanResult);
+            auto builtFiles = Build(language, filesToBuild);
+            for (size_t i = 0; i < builtFiles.size(); i++)
+            {
+                result[resultIndices[i]] = std::move(builtFiles[i]);
+            }
+            WriteIndexFile(language, result);
         }
-        return items;
+        return GetItems(result);
     }
 
     std::vector<TItem> Rebuild(int32_t language) const
     {
-        auto scanResult = Scan();
-        auto items = Build(language, scanResult);
-        return items;
+        auto indexedFiles = Build(language, Scan());
+        WriteIndexFile(language, indexedFiles);
+        return GetItems(indexedFiles);
+    }
+
+    /**
+     * Starts watching the search paths for changes on background threads so that long running
+     * instances can tell when the index needs to be refreshed via TakePendingChanges.
+     */
+    void StartWatching()
+    {
+        for (const auto& directory : SearchPaths)
+        {
+            auto absoluteDirectory = Path::GetAbsolute(directory);
+            if (!Path::DirectoryExists(absoluteDirectory))
+            {
+                continue;
+            }
+
+            try
+            {
+                auto watcher = std::make_unique<FileWatcher>(absoluteDirectory);
+                watcher->OnFileChanged = [this](const std::string&) { _pendingChanges = true; };
+                _watchers.push_back(std::move(watcher));
+            }
+            catch (const std::exception& e)
+            {
+                log_verbose("FileIndex:Unable to watch '%s': %s", absoluteDirectory.c_str(), e.what());
+            }
+        }
+    }
+
+    /**
+     * Whether a watched file has changed since the last call, clearing the flag so that changes
+     * reported while the index is being loaded are picked up by the next call. Always false if
+     * none of the search paths are being watched.
+     */
+    bool TakePendingChanges()
+    {
+        return !_watchers.empty() && _pendingChanges.exchange(false);
     }
 
 protected:
@@ -140,10 +211,9 @@ protected:
     virtual TItem Deserialise(IStream* stream) const abstract;
 
 private:
-    ScanResult Scan() const
+    std::vector<FileStamp> Scan() const
     {
-        DirectoryStats stats{};
-        std::vector<std::string> files;
+        std::vector<FileStamp> files;
         for (const auto& directory : SearchPaths)
         {
             auto absoluteDirectory = Path::GetAbsolute(directory);
@@ -154,61 +224,61 @@ private:
             while (scanner->Next())
             {
                 auto fileInfo = scanner->GetFileInfo();
-                auto path = std::string(scanner->GetPath());
-
-                files.push_back(path);
 
-                stats.TotalFiles++;
-                stats.TotalFileSize += fileInfo->Size;
-                stats.FileDateModifiedChecksum ^= static_cast<uint32_t>(fileInfo->LastModified >> 32)
-                    ^ static_cast<uint32_t>(fileInfo->LastModified & 0xFFFFFFFF);
-                stats.FileDateModifiedChecksum = ror32(stats.FileDateModifiedChecksum, 5);
-                stats.PathChecksum += GetPathChecksum(path);
+                FileStamp stamp;
+                stamp.Path = std::string(scanner->GetPath());
+                stamp.Size = fileInfo->Size;
+                stamp.LastModified = fileInfo->LastModified;
+                files.push_back(std::move(stamp));
             }
             delete scanner;
         }
-        return ScanResult(stats, files);
+        return files;
     }
 
     void BuildRange(
-        int32_t language, const ScanResult& scanResult, size_t rangeStart, size_t rangeEnd, std::vector<TItem>& items,
-        std::atomic<size_t>& processed, std::mutex& printLock) const
+        int32_t language, const std::vector<FileStamp>& files, size_t rangeStart, size_t rangeEnd,
+        std::vector<IndexedFile>& indexedFiles, std::atomic<size_t>& processed, std::mutex& printLock) const
     {
-        items.reserve(rangeEnd - rangeStart);
+        indexedFiles.reserve(rangeEnd - rangeStart);
         for (size_t i = rangeStart; i < rangeEnd; i++)
         {
-            const auto& filePath = scanResult.Files.at(i);
+            const auto& file = files.at(i);
 
             if (_log_levels[DIAGNOSTIC_LEVEL_VERBOSE])
             {
                 std::lock_guard<std::mutex> lock(printLock);
-                log_verbose("FileIndex:Indexing '%s'", filePath.c_str());
+                log_verbose("FileIndex:Indexing '%s'", file.Path.c_str());
             }
 
-            auto item = Create(language, filePath);
-            if (std::get<0>(item))
+            auto item = Create(language, file.Path);
+
+            auto& indexedFile = indexedFiles.emplace_back();
+            indexedFile.Stamp = file;
+            indexedFile.HasItem = std::get<0>(item);
+            if (indexedFile.HasItem)
             {
-                items.push_back(std::get<1>(item));
+                indexedFile.Item = std::get<1>(item);
             }
 
             processed++;
         }
     }
 
-    std::vector<TItem> Build(int32_t language, const ScanResult& scanResult) const
+    std::vector<IndexedFile> Build(int32_t language, const std::vector<FileStamp>& files) const
     {
-        std::vector<TItem> allItems;
-        Console::WriteLine("Building %s (%zu items)", _name.c_str(), scanResult.Files.size());
+        std::vector<IndexedFile> allFiles;
+        Console::WriteLine("Building %s (%zu items)", _name.c_str(), files.size());
 
         auto startTime = std::chrono::high_resolution_clock::now();
 
-        const size_t totalCount = scanResult.Files.size();
+        const size_t totalCount = files.size();
         if (totalCount > 0)
         {
             JobPool jobPool;
             std::mutex printLock; // For verbose prints.
 
-            std::list<std::vector<TItem>> containers;
+            std::list<std::vector<IndexedFile>> containers;
 
             size_t stepSize = 100; // Handpicked, seems to work well with 4/8 cores.
 
@@ -226,36 +296,34 @@ private:
                     stepSize = totalCount - rangeStart;
                 }
 
-                auto& items = containers.emplace_back();
+                auto& indexedFiles = containers.emplace_back();
 
                 jobPool.AddTask(std::bind(
-                    &FileIndex<TItem>::BuildRange, this, language, std::cref(scanResult), rangeStart, rangeStart + stepSize,
-                    std::ref(items), std::ref(processed), std::ref(printLock)));
+                    &FileIndex<TItem>::BuildRange, this, language, std::cref(files), rangeStart, rangeStart + stepSize,
+                    std::ref(indexedFiles), std::ref(processed), std::ref(printLock)));
 
                 reportProgress();
             }
 
             jobPool.Join(reportProgress);
 
+            allFiles.reserve(totalCount);
             for (auto&& itr : containers)
             {
-                allItems.insert(allItems.end(), itr.begin(), itr.end());
+                allFiles.insert(allFiles.end(), std::make_move_iterator(itr.begin()), std::make_move_iterator(itr.end()));
             }
         }
 
-        WriteIndexFile(language, scanResult.Stats, allItems);
-
         auto endTime = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration<float>(endTime - startTime);
         Console::WriteLine("Finished building %s in %.2f seconds.", _name.c_str(), duration.count());
 
-        return allItems;
+        return allFiles;
     }
 
-    std::tuple<bool, std::vector<TItem>> ReadIndexFile(int32_t language, const DirectoryStats& stats) const
+    std::unordered_map<std::string, IndexedFile> ReadIndexFile(int32_t language) const
     {
-        bool loadedItems = false;
-        std::vector<TItem> items;
+        std::unordered_map<std::string, IndexedFile> indexedFiles;
         if (File::Exists(_indexPath))
         {
             try
@@ -263,22 +331,26 @@ private:
                 log_verbose("FileIndex:Loading index: '%s'", _indexPath.c_str());
                 auto fs = FileStream(_indexPath, FILE_MODE_OPEN);
 
-                // Read header, check if we need to re-scan
+                // Read header, an incompatible index is discarded entirely
                 auto header = fs.ReadValue<FileIndexHeader>();
                 if (header.HeaderSize == sizeof(FileIndexHeader) && header.MagicNumber == _magicNumber
-                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language
-                    && header.Stats.TotalFiles == stats.TotalFiles && header.Stats.TotalFileSize == stats.TotalFileSize
-                    && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
-                    && header.Stats.PathChecksum == stats.PathChecksum)
+                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language)
                 {
-                    items.reserve(header.NumItems);
-                    // Directory is the same, just read the saved items
-                    for (uint32_t i = 0; i < header.NumItems; i++)
+                    indexedFiles.reserve(header.NumFiles);
+                    for (uint32_t i = 0; i < header.NumFiles; i++)
                     {
-                        auto item = Deserialise(&fs);
-                        items.push_back(item);
+                        IndexedFile indexedFile;
+                        indexedFile.Stamp.Path = fs.ReadStdString();
+                        indexedFile.Stamp.Size = fs.ReadValue<uint64_t>();
+                        indexedFile.Stamp.LastModified = fs.ReadValue<uint64_t>();
+                        indexedFile.HasItem = fs.ReadValue<uint8_t>() != 0;
+                        if (indexedFile.HasItem)
+                        {
+                            indexedFile.Item = Deserialise(&fs);
+                        }
+                        auto path = indexedFile.Stamp.Path;
+                        indexedFiles.emplace(std::move(path), std::move(indexedFile));
                     }
-                    loadedItems = true;
                 }
                 else
                 {
@@ -289,12 +361,13 @@ private:
             {
                 Console::Error::WriteLine("Unable to load index: '%s'.", _indexPath.c_str());
                 Console::Error::WriteLine("%s", e.what());
+                indexedFiles.clear();
             }
         }
-        return std::make_tuple(loadedItems, items);
+        return indexedFiles;
     }
 
-    void WriteIndexFile(int32_t language, const DirectoryStats& stats, const std::vector<TItem>& items) const
+    void WriteIndexFile(int32_t language, const std::vector<IndexedFile>& indexedFiles) const
     {
         try
         {
@@ -308,14 +381,20 @@ private:
             header.VersionA = FILE_INDEX_VERSION;
             header.VersionB = _version;
             header.LanguageId = language;
-            header.Stats = stats;
-            header.NumItems = static_cast<uint32_t>(items.size());
+            header.NumFiles = static_cast<uint32_t>(indexedFiles.size());
             fs.WriteValue(header);
 
-            // Write items
-            for (const auto& item : items)
+            // Write files and their items
+            for (const auto& indexedFile : indexedFiles)
             {
-                Serialise(&fs, item);
+                fs.WriteString(indexedFile.Stamp.Path);
+                fs.WriteValue<uint64_t>(indexedFile.Stamp.Size);
+                fs.WriteValue<uint64_t>(indexedFile.Stamp.LastModified);
+                fs.WriteValue<uint8_t>(indexedFile.HasItem ? 1 : 0);
+                if (indexedFile.HasItem)
+                {
+                    Serialise(&fs, indexedFile.Item);
+                }
             }
         }
         catch (const std::exception& e)
@@ -325,18 +404,17 @@ private:
         }
     }
 
-    static uint32_t GetPathChecksum(const std::string& path)
+    static std::vector<TItem> GetItems(const std::vector<IndexedFile>& indexedFiles)
     {
-        uint32_t hash = 0xD8430DED;
-        for (const utf8* ch = path.c_str(); *ch != '\0'; ch++)
+        std::vector<TItem> items;
+        items.reserve(indexedFiles.size());
+        for (const auto& indexedFile : indexedFiles)
         {
-            hash += (*ch);
-            hash += (hash << 10);
-            hash ^= (hash >> 6);
+            if (indexedFile.HasItem)
+            {
+                items.push_back(indexedFile.Item);
+            }
         }
-        hash += (hash << 3);
-        hash ^= (hash >> 11);
-        hash += (hash << 15);
-        return hash;
+        return items;
     }
 };
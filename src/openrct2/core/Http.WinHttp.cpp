@@ -172,6 +172,10 @@ namespace Http
             if (hSession == nullptr)
                 ThrowWin32Exception("WinHttpOpen");
 
+            // WinHttp has no overall limit, so the send and receive timeouts each get the whole of it.
+            if (!WinHttpSetTimeouts(hSession, CONNECT_TIMEOUT_MS, CONNECT_TIMEOUT_MS, TIMEOUT_MS, TIMEOUT_MS))
+                ThrowWin32Exception("WinHttpSetTimeouts");
+
             auto wHostName = std::wstring(url.lpszHostName, url.dwHostNameLength);
             hConnect = WinHttpConnect(hSession, wHostName.c_str(), url.nPort, 0);
             if (hConnect == nullptr)
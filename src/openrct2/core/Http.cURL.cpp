@@ -120,6 +120,9 @@ namespace Http
         curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, true);
         curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, true);
         curl_easy_setopt(curl, CURLOPT_USERAGENT, OPENRCT2_USER_AGENT);
+        curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT_MS, static_cast<long>(CONNECT_TIMEOUT_MS));
+        curl_easy_setopt(curl, CURLOPT_TIMEOUT_MS, static_cast<long>(TIMEOUT_MS));
+        curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
 
         curl_slist* chunk = nullptr;
         std::shared_ptr<void> __(nullptr, [chunk](...) { curl_slist_free_all(chunk); });
@@ -12,11 +12,11 @@
 #ifndef DISABLE_HTTP
 
 #    include "../common.h"
+#    include "BackgroundJobs.h"
 
 #    include <functional>
 #    include <map>
 #    include <string>
-#    include <thread>
 
 namespace Http
 {
@@ -51,11 +51,15 @@ namespace Http
         bool forceIPv4 = false;
     };
 
+    // Requests give up after these so that an unresponsive server cannot hold on to a background thread.
+    constexpr int32_t CONNECT_TIMEOUT_MS = 10000;
+    constexpr int32_t TIMEOUT_MS = 60000;
+
     Response Do(const Request& req);
 
     inline void DoAsync(const Request& req, std::function<void(Response& res)> fn)
     {
-        auto thread = std::thread([=]() {
+        BackgroundJobs::Run([=]() {
             Response res;
             try
             {
@@ -68,7 +72,6 @@ namespace Http
             }
             fn(res);
         });
-        thread.detach();
     }
 } // namespace Http
 
@@ -98,6 +98,12 @@ void* MemoryStream::TakeData()
     return _data;
 }
 
+void MemoryStream::Clear()
+{
+    _dataSize = 0;
+    _position = _data;
+}
+
 bool MemoryStream::CanRead() const
 {
     return (_access & MEMORY_ACCESS::READ) != 0;
@@ -47,6 +47,10 @@ public:
     const void* GetData() const override;
     void* GetDataCopy() const;
     void* TakeData();
+    /**
+     * Discards the contents of the stream but keeps its buffer, so it can be reused without allocating.
+     */
+    void Clear();
 
     ///////////////////////////////////////////////////////////////////////////
     // ISteam methods
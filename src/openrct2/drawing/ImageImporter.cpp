@@ -11,15 +11,141 @@
 
 #include "../core/Imaging.h"
 
+#include <algorithm>
+#include <cstdlib>
 #include <cstring>
+#include <limits>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 
 using namespace OpenRCT2::Drawing;
 using ImportResult = ImageImporter::ImportResult;
 
 constexpr int32_t PALETTE_TRANSPARENT = -1;
 
+/**
+ * Precomputed lookups for matching colours against the standard palette. The RGB cube is split into
+ * cells and each cell stores the changable palette entries that can be the closest match for some
+ * colour within it, so a closest colour search only has to measure a handful of entries rather than
+ * the entire palette.
+ */
+class ImageImporter::PaletteLookup
+{
+private:
+    static constexpr int32_t CELL_SHIFT = 3;
+    static constexpr int32_t CELL_SIZE = 1 << CELL_SHIFT;
+    static constexpr int32_t CELLS_PER_AXIS = 256 / CELL_SIZE;
+    static constexpr int32_t NUM_CELLS = CELLS_PER_AXIS * CELLS_PER_AXIS * CELLS_PER_AXIS;
+
+    std::unordered_map<uint32_t, uint8_t> _exactMatches;
+    std::vector<uint32_t> _cellOffsets;
+    std::vector<uint8_t> _cellCandidates;
+
+public:
+    explicit PaletteLookup(const GamePalette& palette)
+    {
+        // The first entry with a given colour wins, like a linear search
+        for (int32_t i = 0; i < PALETTE_SIZE; i++)
+        {
+            _exactMatches.emplace(GetKey(palette[i].Red, palette[i].Green, palette[i].Blue), static_cast<uint8_t>(i));
+        }
+
+        _cellOffsets.reserve(NUM_CELLS + 1);
+        for (int32_t cell = 0; cell < NUM_CELLS; cell++)
+        {
+            const int32_t min[3] = {
+                (cell / (CELLS_PER_AXIS * CELLS_PER_AXIS)) * CELL_SIZE,
+                ((cell / CELLS_PER_AXIS) % CELLS_PER_AXIS) * CELL_SIZE,
+                (cell % CELLS_PER_AXIS) * CELL_SIZE,
+            };
+
+            // An entry can only be the closest match for a colour in the cell if its nearest distance to the
+            // cell does not exceed the smallest furthest distance of any entry.
+            uint32_t minDistances[PALETTE_SIZE]{};
+            uint32_t threshold = std::numeric_limits<uint32_t>::max();
+            for (int32_t i = 0; i < PALETTE_SIZE; i++)
+            {
+                if (IsChangablePixel(i))
+                {
+                    const int32_t entry[3] = { palette[i].Red, palette[i].Green, palette[i].Blue };
+                    uint32_t minDistance = 0;
+                    uint32_t maxDistance = 0;
+                    for (int32_t axis = 0; axis < 3; axis++)
+                    {
+                        auto lo = min[axis];
+                        auto hi = min[axis] + CELL_SIZE - 1;
+                        auto nearest = std::clamp(entry[axis], lo, hi);
+                        auto furthest = std::max(std::abs(entry[axis] - lo), std::abs(entry[axis] - hi));
+                        minDistance += (entry[axis] - nearest) * (entry[axis] - nearest);
+                        maxDistance += furthest * furthest;
+                    }
+                    minDistances[i] = minDistance;
+                    threshold = std::min(threshold, maxDistance);
+                }
+            }
+
+            _cellOffsets.push_back(static_cast<uint32_t>(_cellCandidates.size()));
+            for (int32_t i = 0; i < PALETTE_SIZE; i++)
+            {
+                if (IsChangablePixel(i) && minDistances[i] <= threshold)
+                {
+                    _cellCandidates.push_back(static_cast<uint8_t>(i));
+                }
+            }
+        }
+        _cellOffsets.push_back(static_cast<uint32_t>(_cellCandidates.size()));
+    }
+
+    int32_t GetIndex(int16_t r, int16_t g, int16_t b) const
+    {
+        if (IsInRange(r, g, b))
+        {
+            auto it = _exactMatches.find(GetKey(r, g, b));
+            if (it != _exactMatches.end())
+            {
+                return it->second;
+            }
+        }
+        return PALETTE_TRANSPARENT;
+    }
+
+    /**
+     * Gets the candidate palette entries, in ascending order, for the given colour.
+     * @returns false if the colour is outside of the RGB cube and no candidates are known.
+     */
+    bool GetCandidates(int16_t r, int16_t g, int16_t b, const uint8_t** outBegin, const uint8_t** outEnd) const
+    {
+        if (!IsInRange(r, g, b))
+        {
+            return false;
+        }
+
+        auto cell = ((r >> CELL_SHIFT) * CELLS_PER_AXIS + (g >> CELL_SHIFT)) * CELLS_PER_AXIS + (b >> CELL_SHIFT);
+        *outBegin = _cellCandidates.data() + _cellOffsets[cell];
+        *outEnd = _cellCandidates.data() + _cellOffsets[cell + 1];
+        return true;
+    }
+
+private:
+    static uint32_t GetKey(int32_t r, int32_t g, int32_t b)
+    {
+        return (r << 16) | (g << 8) | b;
+    }
+
+    static bool IsInRange(int16_t r, int16_t g, int16_t b)
+    {
+        return r >= 0 && r <= 255 && g >= 0 && g <= 255 && b >= 0 && b <= 255;
+    }
+};
+
+const ImageImporter::PaletteLookup& ImageImporter::GetPaletteLookup()
+{
+    // Built on first use, static initialisation is thread safe so images can be imported in parallel
+    static const PaletteLookup lookup(StandardPalette);
+    return lookup;
+}
+
 ImportResult ImageImporter::Import(
     const Image& image, int32_t offsetX, int32_t offsetY, IMPORT_FLAGS flags, IMPORT_MODE mode) const
 {
@@ -226,17 +352,17 @@ int32_t ImageImporter::CalculatePaletteIndex(
     IMPORT_MODE mode, int16_t* rgbaSrc, int32_t x, int32_t y, int32_t width, int32_t height)
 {
     auto& palette = StandardPalette;
-    auto paletteIndex = GetPaletteIndex(palette, rgbaSrc);
+    auto paletteIndex = GetPaletteIndex(rgbaSrc);
     if (mode == IMPORT_MODE::CLOSEST || mode == IMPORT_MODE::DITHERING)
     {
         if (paletteIndex == PALETTE_TRANSPARENT && !IsTransparentPixel(rgbaSrc))
         {
-            paletteIndex = GetClosestPaletteIndex(palette, rgbaSrc);
+            paletteIndex = GetClosestPaletteIndex(rgbaSrc);
         }
     }
     if (mode == IMPORT_MODE::DITHERING)
     {
-        if (!IsTransparentPixel(rgbaSrc) && IsChangablePixel(GetPaletteIndex(palette, rgbaSrc)))
+        if (!IsTransparentPixel(rgbaSrc) && IsChangablePixel(GetPaletteIndex(rgbaSrc)))
         {
             auto dr = rgbaSrc[0] - static_cast<int16_t>(palette[paletteIndex].Red);
             auto dg = rgbaSrc[1] - static_cast<int16_t>(palette[paletteIndex].Green);
@@ -244,7 +370,7 @@ int32_t ImageImporter::CalculatePaletteIndex(
 
             if (x + 1 < width)
             {
-                if (!IsTransparentPixel(rgbaSrc + 4) && IsChangablePixel(GetPaletteIndex(palette, rgbaSrc + 4)))
+                if (!IsTransparentPixel(rgbaSrc + 4) && IsChangablePixel(GetPaletteIndex(rgbaSrc + 4)))
                 {
                     // Right
                     rgbaSrc[4] += dr * 7 / 16;
@@ -258,7 +384,7 @@ int32_t ImageImporter::CalculatePaletteIndex(
                 if (x > 0)
                 {
                     if (!IsTransparentPixel(rgbaSrc + 4 * (width - 1))
-                        && IsChangablePixel(GetPaletteIndex(palette, rgbaSrc + 4 * (width - 1))))
+                        && IsChangablePixel(GetPaletteIndex(rgbaSrc + 4 * (width - 1))))
                     {
                         // Bottom left
                         rgbaSrc[4 * (width - 1)] += dr * 3 / 16;
@@ -268,7 +394,7 @@ int32_t ImageImporter::CalculatePaletteIndex(
                 }
 
                 // Bottom
-                if (!IsTransparentPixel(rgbaSrc + 4 * width) && IsChangablePixel(GetPaletteIndex(palette, rgbaSrc + 4 * width)))
+                if (!IsTransparentPixel(rgbaSrc + 4 * width) && IsChangablePixel(GetPaletteIndex(rgbaSrc + 4 * width)))
                 {
                     rgbaSrc[4 * width] += dr * 5 / 16;
                     rgbaSrc[4 * width + 1] += dg * 5 / 16;
@@ -278,7 +404,7 @@ int32_t ImageImporter::CalculatePaletteIndex(
                 if (x + 1 < width)
                 {
                     if (!IsTransparentPixel(rgbaSrc + 4 * (width + 1))
-                        && IsChangablePixel(GetPaletteIndex(palette, rgbaSrc + 4 * (width + 1))))
+                        && IsChangablePixel(GetPaletteIndex(rgbaSrc + 4 * (width + 1))))
                     {
                         // Bottom right
                         rgbaSrc[4 * (width + 1)] += dr * 1 / 16;
@@ -292,18 +418,11 @@ int32_t ImageImporter::CalculatePaletteIndex(
     return paletteIndex;
 }
 
-int32_t ImageImporter::GetPaletteIndex(const GamePalette& palette, int16_t* colour)
+int32_t ImageImporter::GetPaletteIndex(const int16_t* colour)
 {
     if (!IsTransparentPixel(colour))
     {
-        for (int32_t i = 0; i < PALETTE_SIZE; i++)
-        {
-            if (static_cast<int16_t>(palette[i].Red) == colour[0] && static_cast<int16_t>(palette[i].Green) == colour[1]
-                && static_cast<int16_t>(palette[i].Blue) == colour[2])
-            {
-                return i;
-            }
-        }
+        return GetPaletteLookup().GetIndex(colour[0], colour[1], colour[2]);
     }
     return PALETTE_TRANSPARENT;
 }
@@ -333,19 +452,40 @@ bool ImageImporter::IsChangablePixel(int32_t paletteIndex)
     return true;
 }
 
-int32_t ImageImporter::GetClosestPaletteIndex(const GamePalette& palette, const int16_t* colour)
+int32_t ImageImporter::GetClosestPaletteIndex(const int16_t* colour)
 {
+    auto& palette = StandardPalette;
+    auto getError = [&palette, colour](int32_t x) -> uint32_t {
+        return (static_cast<int16_t>(palette[x].Red) - colour[0]) * (static_cast<int16_t>(palette[x].Red) - colour[0])
+            + (static_cast<int16_t>(palette[x].Green) - colour[1]) * (static_cast<int16_t>(palette[x].Green) - colour[1])
+            + (static_cast<int16_t>(palette[x].Blue) - colour[2]) * (static_cast<int16_t>(palette[x].Blue) - colour[2]);
+    };
+
     auto smallestError = static_cast<uint32_t>(-1);
     auto bestMatch = PALETTE_TRANSPARENT;
+
+    const uint8_t* candidatesBegin;
+    const uint8_t* candidatesEnd;
+    if (GetPaletteLookup().GetCandidates(colour[0], colour[1], colour[2], &candidatesBegin, &candidatesEnd))
+    {
+        for (auto it = candidatesBegin; it != candidatesEnd; it++)
+        {
+            auto error = getError(*it);
+            if (smallestError == static_cast<uint32_t>(-1) || smallestError > error)
+            {
+                bestMatch = *it;
+                smallestError = error;
+            }
+        }
+        return bestMatch;
+    }
+
+    // Dithering can push colours outside of the RGB cube, fall back to testing every entry
     for (int32_t x = 0; x < PALETTE_SIZE; x++)
     {
         if (IsChangablePixel(x))
         {
-            uint32_t error = (static_cast<int16_t>(palette[x].Red) - colour[0])
-                    * (static_cast<int16_t>(palette[x].Red) - colour[0])
-                + (static_cast<int16_t>(palette[x].Green) - colour[1]) * (static_cast<int16_t>(palette[x].Green) - colour[1])
-                + (static_cast<int16_t>(palette[x].Blue) - colour[2]) * (static_cast<int16_t>(palette[x].Blue) - colour[2]);
-
+            auto error = getError(x);
             if (smallestError == static_cast<uint32_t>(-1) || smallestError > error)
             {
                 bestMatch = x;
@@ -51,6 +51,9 @@ namespace OpenRCT2::Drawing
             IMPORT_MODE mode = IMPORT_MODE::DEFAULT) const;
 
     private:
+        class PaletteLookup;
+
+        static const PaletteLookup& GetPaletteLookup();
         static std::vector<int32_t> GetPixels(
             const uint8_t* pixels, uint32_t width, uint32_t height, IMPORT_FLAGS flags, IMPORT_MODE mode);
         static std::tuple<void*, size_t> EncodeRaw(const int32_t* pixels, uint32_t width, uint32_t height);
@@ -58,10 +61,10 @@ namespace OpenRCT2::Drawing
 
         static int32_t CalculatePaletteIndex(
             IMPORT_MODE mode, int16_t* rgbaSrc, int32_t x, int32_t y, int32_t width, int32_t height);
-        static int32_t GetPaletteIndex(const GamePalette& palette, int16_t* colour);
+        static int32_t GetPaletteIndex(const int16_t* colour);
         static bool IsTransparentPixel(const int16_t* colour);
         static bool IsChangablePixel(int32_t paletteIndex);
-        static int32_t GetClosestPaletteIndex(const GamePalette& palette, const int16_t* colour);
+        static int32_t GetClosestPaletteIndex(const int16_t* colour);
     };
 } // namespace OpenRCT2::Drawing
 
@@ -57,6 +57,7 @@
 #include <cstdlib>
 #include <deque>
 #include <exception>
+#include <sstream>
 #include <string>
 #include <thread>
 #include <vector>
@@ -423,10 +424,27 @@ static int32_t cc_rides(InteractiveConsole& console, const arguments_t& argv)
                 }
             }
         }
+        else if (argv[0] == "ratings")
+        {
+            if (network_get_mode() != NETWORK_MODE_NONE)
+            {
+                console.WriteFormatLine("This command is currently not supported in multiplayer mode.");
+            }
+            else
+            {
+                std::vector<ride_id_t> rideIds;
+                for (const auto& ride : GetRideManager())
+                {
+                    rideIds.push_back(ride.id);
+                }
+                ride_ratings_update_rides(rideIds);
+                console.WriteFormatLine("Recalculated the ratings of %zu rides", rideIds.size());
+            }
+        }
     }
     else
     {
-        console.WriteFormatLine("subcommands: list, set");
+        console.WriteFormatLine("subcommands: list, set, ratings");
     }
     return 0;
 }
@@ -1475,14 +1493,21 @@ static int32_t cc_replay_start(InteractiveConsole& console, const arguments_t& a
 
     if (argv.size() < 1)
     {
-        console.WriteFormatLine("Parameters required <replay_name>");
+        console.WriteFormatLine("Parameters required <replay_name> [<start_tick = 0>]");
         return 0;
     }
 
     std::string name = argv[0];
 
+    // Optionally start playback part way through the replay.
+    uint32_t startTick = 0;
+    if (argv.size() >= 2)
+    {
+        startTick = atol(argv[1].c_str());
+    }
+
     auto* replayManager = OpenRCT2::GetContext()->GetReplayManager();
-    if (replayManager->StartPlayback(name))
+    if (replayManager->StartPlayback(name, startTick))
     {
         OpenRCT2::ReplayRecordInfo info;
         replayManager->GetCurrentReplayInfo(info);
@@ -1496,10 +1521,13 @@ static int32_t cc_replay_start(InteractiveConsole& console, const arguments_t& a
                              "  Date Recorded: %s\n"
                              "  Ticks: %u\n"
                              "  Commands: %u\n"
-                             "  Checksums: %u";
+                             "  Checksums: %u\n"
+                             "  Keyframes: %u";
 
-        console.WriteFormatLine(logFmt, info.FilePath.c_str(), recordingDate, info.Ticks, info.NumCommands, info.NumChecksums);
-        log_info(logFmt, info.FilePath.c_str(), recordingDate, info.Ticks, info.NumCommands, info.NumChecksums);
+        console.WriteFormatLine(
+            logFmt, info.FilePath.c_str(), recordingDate, info.Ticks, info.NumCommands, info.NumChecksums, info.NumKeyframes);
+        log_info(
+            logFmt, info.FilePath.c_str(), recordingDate, info.Ticks, info.NumCommands, info.NumChecksums, info.NumKeyframes);
 
         return 1;
     }
@@ -1560,6 +1588,23 @@ static int32_t cc_replay_normalise(InteractiveConsole& console, const arguments_
     return 0;
 }
 
+static int32_t cc_mp_metrics(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    if (network_get_mode() == NETWORK_MODE_NONE)
+    {
+        console.WriteLineError("Not in a multiplayer game.");
+        return 1;
+    }
+
+    std::istringstream metrics(network_get_metrics());
+    std::string line;
+    while (std::getline(metrics, line))
+    {
+        console.WriteLine(line);
+    }
+    return 0;
+}
+
 static int32_t cc_mp_desync(InteractiveConsole& console, const arguments_t& argv)
 {
     int32_t desyncType = 0;
@@ -1775,9 +1820,10 @@ static constexpr const console_command console_command_table[] = {
     { "windows", cc_windows, "Lists all the windows that can be opened.", "windows" },
     { "replay_startrecord", cc_replay_startrecord, "Starts recording a new replay.", "replay_startrecord <name> [max_ticks]"},
     { "replay_stoprecord", cc_replay_stoprecord, "Stops recording a new replay.", "replay_stoprecord"},
-    { "replay_start", cc_replay_start, "Starts a replay", "replay_start <name>"},
+    { "replay_start", cc_replay_start, "Starts a replay", "replay_start <name> [start_tick]"},
     { "replay_stop", cc_replay_stop, "Stops the replay", "replay_stop"},
     { "replay_normalise", cc_replay_normalise, "Normalises the replay to remove all gaps", "replay_normalise <input file> <output file>"},
+    { "mp_metrics", cc_mp_metrics, "Prints the multiplayer performance and health metrics", "mp_metrics"},
     { "mp_desync", cc_mp_desync, "Forces a multiplayer desync", "cc_mp_desync [desync_type, 0 = Random t-shirt color on random peep, 1 = Remove random peep ]"},
 
 };
@@ -32,14 +32,14 @@
 // This string specifies which version of network stream current build uses.
 // It is used for making sure only compatible builds get connected, even within
 // single OpenRCT2 version.
-#define NETWORK_STREAM_VERSION "19"
+#define NETWORK_STREAM_VERSION "21"
 #define NETWORK_STREAM_ID OPENRCT2_VERSION "-" NETWORK_STREAM_VERSION
 
 static Peep* _pickup_peep = nullptr;
 static int32_t _pickup_peep_old_x = LOCATION_NULL;
 
-// General chunk size is 63 KiB, this can not be any larger because the packet size is encoded
-// with uint16_t and needs some spare room for other data in the packet.
+// General chunk size is 63 KiB, this keeps each chunk within the 16-bit packet size so only larger
+// packets need the extended size prefix, and lets the client report progress while the map downloads.
 static constexpr uint32_t CHUNK_SIZE = 1024 * 63;
 
 #ifndef DISABLE_NETWORK
@@ -70,6 +70,7 @@ static constexpr uint32_t CHUNK_SIZE = 1024 * 63;
 #    include "NetworkConnection.h"
 #    include "NetworkGroup.h"
 #    include "NetworkKey.h"
+#    include "NetworkMetrics.h"
 #    include "NetworkPacket.h"
 #    include "NetworkPlayer.h"
 #    include "NetworkServerAdvertiser.h"
@@ -82,6 +83,7 @@ static constexpr uint32_t CHUNK_SIZE = 1024 * 63;
 #    include <cmath>
 #    include <fstream>
 #    include <functional>
+#    include <limits>
 #    include <list>
 #    include <map>
 #    include <memory>
@@ -130,6 +132,7 @@ public:
     uint8_t GetPlayerID();
     void Update();
     void Flush();
+    bool WaitForActivity(uint32_t timeoutMs);
     void ProcessPending();
     void ProcessPlayerList();
     void ProcessPlayerInfo();
@@ -180,6 +183,8 @@ public:
     void Server_Send_CHAT(const char* text, const std::vector<uint8_t>& playerIds = {});
     void Client_Send_GAME_ACTION(const GameAction* action);
     void Server_Send_GAME_ACTION(const GameAction* action);
+    void Server_Send_GAME_ACTION_REJECTED(
+        NetworkConnection& connection, const GameAction* action, const GameActionResult* result);
     void Server_Send_TICK();
     void Server_Send_PLAYERINFO(int32_t playerId);
     void Server_Send_PLAYERLIST();
@@ -198,13 +203,14 @@ public:
     void Server_Send_SCRIPTS(NetworkConnection& connection) const;
 
     NetworkStats_t GetStats() const;
+    std::string GetMetrics() const;
+    void RecordTickDuration(double seconds);
     json_t* GetServerInfoAsJson() const;
 
     std::vector<std::unique_ptr<NetworkPlayer>> player_list;
     std::vector<std::unique_ptr<NetworkGroup>> group_list;
     NetworkKey _key;
     std::vector<uint8_t> _challenge;
-    std::map<uint32_t, GameAction::Callback_t> _gameActionCallbacks;
     NetworkUserManager _userManager;
     std::string ServerName;
     std::string ServerDescription;
@@ -246,6 +252,7 @@ private:
     };
 
     std::map<uint32_t, ServerTickData_t> _serverTickData;
+    std::map<uint32_t, GameAction::Ptr> _pendingGameActions;
     std::map<uint32_t, PlayerListUpdate> _pendingPlayerLists;
     std::multimap<uint32_t, NetworkPlayer> _pendingPlayerInfo;
     bool _playerListInvalidated = false;
@@ -259,6 +266,11 @@ private:
     std::unique_ptr<ITcpSocket> _listenSocket;
     std::unique_ptr<NetworkConnection> _serverConnection;
     std::unique_ptr<INetworkServerAdvertiser> _advertiser;
+    std::unique_ptr<INetworkMetricsServer> _metricsServer;
+    TickDurationHistogram _tickDurations;
+    uint64_t _desyncCount = 0;
+    uint64_t _desyncReportCount = 0;
+    NetworkStats_t _disconnectedStats = {};
     uint16_t listening_port = 0;
     SOCKET_STATUS _lastConnectStatus = SOCKET_STATUS_CLOSED;
     uint32_t last_ping_sent_time = 0;
@@ -296,6 +308,7 @@ private:
     void Server_Handle_CHAT(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_GAME_ACTION(NetworkConnection& connection, NetworkPacket& packet);
     void Server_Handle_GAME_ACTION(NetworkConnection& connection, NetworkPacket& packet);
+    void Client_Handle_GAME_ACTION_REJECTED(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_TICK(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_PLAYERINFO(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_PLAYERLIST(NetworkConnection& connection, NetworkPacket& packet);
@@ -349,6 +362,7 @@ Network::Network()
     client_command_handlers[NETWORK_COMMAND_OBJECTS] = &Network::Client_Handle_OBJECTS;
     client_command_handlers[NETWORK_COMMAND_SCRIPTS] = &Network::Client_Handle_SCRIPTS;
     client_command_handlers[NETWORK_COMMAND_GAMESTATE] = &Network::Client_Handle_GAMESTATE;
+    client_command_handlers[NETWORK_COMMAND_GAME_ACTION_REJECTED] = &Network::Client_Handle_GAME_ACTION_REJECTED;
     server_command_handlers.resize(NETWORK_COMMAND_MAX, nullptr);
     server_command_handlers[NETWORK_COMMAND_AUTH] = &Network::Server_Handle_AUTH;
     server_command_handlers[NETWORK_COMMAND_CHAT] = &Network::Server_Handle_CHAT;
@@ -457,6 +471,7 @@ void Network::CloseConnection()
     {
         _listenSocket.reset();
         _advertiser.reset();
+        _metricsServer.reset();
     }
 
     mode = NETWORK_MODE_NONE;
@@ -627,6 +642,24 @@ bool Network::BeginServer(uint16_t port, const std::string& address)
     listening_port = port;
     _serverState.gamestateSnapshotsEnabled = gConfigNetwork.desync_debugging;
     _advertiser = CreateServerAdvertiser(listening_port);
+    _disconnectedStats = {};
+    if (gConfigNetwork.metrics_port < 0 || gConfigNetwork.metrics_port > std::numeric_limits<uint16_t>::max())
+    {
+        log_error(
+            "Unable to serve metrics, metrics_port must be between 1 and 65535 but is %d.", gConfigNetwork.metrics_port);
+    }
+    else if (gConfigNetwork.metrics_port != 0)
+    {
+        try
+        {
+            _metricsServer = CreateMetricsServer(
+                gConfigNetwork.metrics_address, static_cast<uint16_t>(gConfigNetwork.metrics_port));
+        }
+        catch (const std::exception& ex)
+        {
+            log_error("Unable to serve metrics on port %d: %s", gConfigNetwork.metrics_port, ex.what());
+        }
+    }
 
     game_load_scripts();
 
@@ -725,6 +758,32 @@ void Network::Flush()
     }
 }
 
+/**
+ * Blocks until the listen socket or one of the connections has data to process, or until the timeout expires.
+ */
+bool Network::WaitForActivity(uint32_t timeoutMs)
+{
+    std::vector<const ITcpSocket*> sockets;
+    switch (GetMode())
+    {
+        case NETWORK_MODE_SERVER:
+            sockets.reserve(client_connection_list.size() + 1);
+            sockets.push_back(_listenSocket.get());
+            for (const auto& connection : client_connection_list)
+            {
+                if (!connection->IsDisconnected)
+                {
+                    sockets.push_back(connection->Socket.get());
+                }
+            }
+            break;
+        case NETWORK_MODE_CLIENT:
+            sockets.push_back(_serverConnection->Socket.get());
+            break;
+    }
+    return WaitForSocketActivity(sockets, timeoutMs);
+}
+
 void Network::UpdateServer()
 {
     for (auto& connection : client_connection_list)
@@ -755,6 +814,11 @@ void Network::UpdateServer()
         _advertiser->Update();
     }
 
+    if (_metricsServer != nullptr)
+    {
+        _metricsServer->Update();
+    }
+
     std::unique_ptr<ITcpSocket> tcpSocket = _listenSocket->Accept();
     if (tcpSocket != nullptr)
     {
@@ -1004,6 +1068,7 @@ bool Network::CheckDesynchronizaton()
     {
         _serverState.state = NETWORK_SERVER_STATE_DESYNCED;
         _serverState.desyncTick = gCurrentTicks;
+        _desyncCount++;
 
         char str_desync[256];
         format_string(str_desync, 256, STR_MULTIPLAYER_DESYNC, nullptr);
@@ -1520,6 +1585,22 @@ void Network::Server_Send_SCRIPTS(NetworkConnection& connection) const
     connection.QueuePacket(std::move(packet));
 }
 
+static void AddStats(NetworkStats_t& total, const NetworkStats_t& stats)
+{
+    for (size_t n = 0; n < NETWORK_STATISTICS_GROUP_MAX; n++)
+    {
+        total.bytesReceived[n] += stats.bytesReceived[n];
+        total.bytesSent[n] += stats.bytesSent[n];
+    }
+    for (size_t n = 0; n < NETWORK_COMMAND_MAX; n++)
+    {
+        total.commandBytesReceived[n] += stats.commandBytesReceived[n];
+        total.commandBytesSent[n] += stats.commandBytesSent[n];
+        total.commandPacketsReceived[n] += stats.commandPacketsReceived[n];
+        total.commandPacketsSent[n] += stats.commandPacketsSent[n];
+    }
+}
+
 NetworkStats_t Network::GetStats() const
 {
     NetworkStats_t stats = {};
@@ -1531,16 +1612,87 @@ NetworkStats_t Network::GetStats() const
     {
         for (auto& connection : client_connection_list)
         {
-            for (size_t n = 0; n < NETWORK_STATISTICS_GROUP_MAX; n++)
-            {
-                stats.bytesReceived[n] += connection->Stats.bytesReceived[n];
-                stats.bytesSent[n] += connection->Stats.bytesSent[n];
-            }
+            AddStats(stats, connection->Stats);
         }
     }
     return stats;
 }
 
+std::string Network::GetMetrics() const
+{
+    MetricsWriter writer;
+    writer.Declare("openrct2_tick_duration_seconds", "histogram", "Time taken to update the game logic for one tick.");
+    writer.Write("openrct2_tick_duration_seconds", _tickDurations);
+
+    if (mode == NETWORK_MODE_CLIENT)
+    {
+        writer.Declare(
+            "openrct2_desyncs_total", "counter",
+            "Number of times this client went out of sync with the server, client-only.");
+        writer.Write("openrct2_desyncs_total", static_cast<double>(_desyncCount));
+    }
+
+    writer.Declare(
+        "openrct2_desync_reports_total", "counter",
+        "Number of game states requested by clients that went out of sync, only sent with desync_debugging.");
+    writer.Write("openrct2_desync_reports_total", static_cast<double>(_desyncReportCount));
+
+    writer.Declare("openrct2_players", "gauge", "Number of players in the game, including the host.");
+    writer.Write("openrct2_players", static_cast<double>(player_list.size()));
+
+    writer.Declare("openrct2_send_queue_packets", "gauge", "Number of packets waiting to be sent to each player.");
+    for (const auto& connection : client_connection_list)
+    {
+        if (connection->Player != nullptr)
+        {
+            auto queued = static_cast<double>(connection->GetQueuedPacketCount());
+            writer.Write("openrct2_send_queue_packets", "player", connection->Player->Name, queued);
+        }
+    }
+
+    writer.Declare("openrct2_ping_milliseconds", "gauge", "Round trip time to each player.");
+    for (const auto& connection : client_connection_list)
+    {
+        if (connection->Player != nullptr)
+        {
+            writer.Write("openrct2_ping_milliseconds", "player", connection->Player->Name, connection->Player->Ping);
+        }
+    }
+
+    auto stats = GetStats();
+    AddStats(stats, _disconnectedStats);
+    writer.Declare("openrct2_packets_received_total", "counter", "Number of packets received by command.");
+    for (size_t n = 0; n < NETWORK_COMMAND_MAX; n++)
+    {
+        auto value = static_cast<double>(stats.commandPacketsReceived[n]);
+        writer.Write("openrct2_packets_received_total", "command", NetworkCommandNames[n], value);
+    }
+    writer.Declare("openrct2_packets_sent_total", "counter", "Number of packets sent by command.");
+    for (size_t n = 0; n < NETWORK_COMMAND_MAX; n++)
+    {
+        auto value = static_cast<double>(stats.commandPacketsSent[n]);
+        writer.Write("openrct2_packets_sent_total", "command", NetworkCommandNames[n], value);
+    }
+    writer.Declare("openrct2_bytes_received_total", "counter", "Number of bytes received by command.");
+    for (size_t n = 0; n < NETWORK_COMMAND_MAX; n++)
+    {
+        auto value = static_cast<double>(stats.commandBytesReceived[n]);
+        writer.Write("openrct2_bytes_received_total", "command", NetworkCommandNames[n], value);
+    }
+    writer.Declare("openrct2_bytes_sent_total", "counter", "Number of bytes sent by command.");
+    for (size_t n = 0; n < NETWORK_COMMAND_MAX; n++)
+    {
+        auto value = static_cast<double>(stats.commandBytesSent[n]);
+        writer.Write("openrct2_bytes_sent_total", "command", NetworkCommandNames[n], value);
+    }
+    return writer.GetText();
+}
+
+void Network::RecordTickDuration(double seconds)
+{
+    _tickDurations.Record(seconds);
+}
+
 void Network::Server_Send_AUTH(NetworkConnection& connection)
 {
     uint8_t new_playerid = 0;
@@ -1703,13 +1855,13 @@ void Network::Client_Send_GAME_ACTION(const GameAction* action)
     const_cast<GameAction*>(action)->SetNetworkId(networkId);
     if (action->GetCallback())
     {
-        _gameActionCallbacks.insert(std::make_pair(networkId, action->GetCallback()));
+        _pendingGameActions.emplace(networkId, GameActions::Clone(action));
     }
 
-    DataSerialiser stream(true);
-    action->Serialise(stream);
-
-    *packet << static_cast<uint32_t>(NETWORK_COMMAND_GAME_ACTION) << gCurrentTicks << action->GetType() << stream;
+    *packet << static_cast<uint32_t>(NETWORK_COMMAND_GAME_ACTION) << gCurrentTicks << action->GetType();
+    NetworkPacketStream stream(*packet);
+    DataSerialiser ds(true, stream);
+    action->Serialise(ds);
     _serverConnection->QueuePacket(std::move(packet));
 }
 
@@ -1717,14 +1869,25 @@ void Network::Server_Send_GAME_ACTION(const GameAction* action)
 {
     std::unique_ptr<NetworkPacket> packet(NetworkPacket::Allocate());
 
-    DataSerialiser stream(true);
-    action->Serialise(stream);
-
-    *packet << static_cast<uint32_t>(NETWORK_COMMAND_GAME_ACTION) << gCurrentTicks << action->GetType() << stream;
+    *packet << static_cast<uint32_t>(NETWORK_COMMAND_GAME_ACTION) << gCurrentTicks << action->GetType();
+    NetworkPacketStream stream(*packet);
+    DataSerialiser ds(true, stream);
+    action->Serialise(ds);
 
     SendPacketToClients(*packet);
 }
 
+void Network::Server_Send_GAME_ACTION_REJECTED(
+    NetworkConnection& connection, const GameAction* action, const GameActionResult* result)
+{
+    std::unique_ptr<NetworkPacket> packet(NetworkPacket::Allocate());
+    *packet << static_cast<uint32_t>(NETWORK_COMMAND_GAME_ACTION_REJECTED) << action->GetNetworkId()
+            << static_cast<uint16_t>(result->Error);
+    packet->WriteString(result->GetErrorTitle().c_str());
+    packet->WriteString(result->GetErrorMessage().c_str());
+    connection.QueuePacket(std::move(packet));
+}
+
 void Network::Server_Send_TICK()
 {
     std::unique_ptr<NetworkPacket> packet(NetworkPacket::Allocate());
@@ -2163,6 +2326,9 @@ void Network::ProcessDisconnectedClients()
         auto& connection = *it;
         if (connection->IsDisconnected)
         {
+            // Keep the traffic of past connections so the metrics only ever count up.
+            AddStats(_disconnectedStats, connection->Stats);
+
             ServerClientDisconnected(connection);
             RemovePlayer(connection);
 
@@ -2406,6 +2572,7 @@ void Network::Server_Handle_REQUEST_GAMESTATE(NetworkConnection& connection, Net
 {
     uint32_t tick;
     packet >> tick;
+    _desyncReportCount++;
 
     if (_serverState.gamestateSnapshotsEnabled == false)
     {
@@ -3095,11 +3262,9 @@ void Network::Client_Handle_GAME_ACTION([[maybe_unused]] NetworkConnection& conn
     uint32_t actionType;
     packet >> tick >> actionType;
 
-    MemoryStream stream;
+    // Read the action straight from the packet data.
     size_t size = packet.Size - packet.BytesRead;
-    stream.WriteArray(packet.Read(size), size);
-    stream.SetPosition(0);
-
+    MemoryStream stream(packet.Read(size), size);
     DataSerialiser ds(false, stream);
 
     GameAction::Ptr action = GameActions::Create(actionType);
@@ -3114,17 +3279,57 @@ void Network::Client_Handle_GAME_ACTION([[maybe_unused]] NetworkConnection& conn
     {
         // Only execute callbacks that belong to us,
         // clients can have identical network ids assigned.
-        auto itr = _gameActionCallbacks.find(action->GetNetworkId());
-        if (itr != _gameActionCallbacks.end())
+        auto itr = _pendingGameActions.find(action->GetNetworkId());
+        if (itr != _pendingGameActions.end())
         {
-            action->SetCallback(itr->second);
-            _gameActionCallbacks.erase(itr);
+            // Predicted actions already reported their result when they were sent.
+            if (!itr->second->IsClientPredicted())
+            {
+                action->SetCallback(itr->second->GetCallback());
+            }
+            _pendingGameActions.erase(itr);
         }
     }
 
     GameActions::Enqueue(std::move(action), tick);
 }
 
+/**
+ * The server tells the client that sent an action when it fails, whether it was refused straight away or failed when it
+ * ran. Otherwise the callback would never be called.
+ */
+void Network::Client_Handle_GAME_ACTION_REJECTED([[maybe_unused]] NetworkConnection& connection, NetworkPacket& packet)
+{
+    uint32_t networkId;
+    uint16_t error;
+    packet >> networkId >> error;
+    auto title = packet.ReadString();
+    auto message = packet.ReadString();
+
+    auto itr = _pendingGameActions.find(networkId);
+    if (itr == _pendingGameActions.end())
+    {
+        return;
+    }
+    auto action = std::move(itr->second);
+    _pendingGameActions.erase(itr);
+
+    log_verbose("Game action %s (%u) was rejected by the server", action->GetName(), networkId);
+    GameActionResult result;
+    result.Error = static_cast<GA_ERROR>(error);
+    result.ErrorTitle = title == nullptr ? "" : title;
+    result.ErrorMessage = message == nullptr ? "" : message;
+    if (action->IsClientPredicted())
+    {
+        // The callback already had the predicted result.
+        action->GetRejectedCallback()(action.get(), &result);
+    }
+    else
+    {
+        action->GetCallback()(action.get(), &result);
+    }
+}
+
 void Network::Server_Handle_GAME_ACTION(NetworkConnection& connection, NetworkPacket& packet)
 {
     uint32_t tick;
@@ -3144,6 +3349,22 @@ void Network::Server_Handle_GAME_ACTION(NetworkConnection& connection, NetworkPa
         return;
     }
 
+    // Create the action first so that a refusal can name it.
+    GameAction::Ptr ga = GameActions::Create(actionType);
+    if (ga == nullptr)
+    {
+        log_error(
+            "Received unregistered game action type: 0x%08X from player: (%d) %s", actionType, connection.Player->Id,
+            connection.Player->Name.c_str());
+        return;
+    }
+
+    // Read the action straight from the packet data.
+    size_t size = packet.Size - packet.BytesRead;
+    MemoryStream stream(packet.Read(size), size);
+    DataSerialiser ds(false, stream);
+    ga->Serialise(ds);
+
     if (actionType != GAME_COMMAND_CUSTOM)
     {
         // Check if player's group permission allows command to run
@@ -3151,20 +3372,12 @@ void Network::Server_Handle_GAME_ACTION(NetworkConnection& connection, NetworkPa
         if (group == nullptr || group->CanPerformCommand(actionType) == false)
         {
             Server_Send_SHOWERROR(connection, STR_CANT_DO_THIS, STR_PERMISSION_DENIED);
+            GameActionResult result(GA_ERROR::DISALLOWED, STR_CANT_DO_THIS, STR_PERMISSION_DENIED);
+            Server_Send_GAME_ACTION_REJECTED(connection, ga.get(), &result);
             return;
         }
     }
 
-    // Create and enqueue the action.
-    GameAction::Ptr ga = GameActions::Create(actionType);
-    if (ga == nullptr)
-    {
-        log_error(
-            "Received unregistered game action type: 0x%08X from player: (%d) %s", actionType, connection.Player->Id,
-            connection.Player->Name.c_str());
-        return;
-    }
-
     // Player who is hosting is not affected by cooldowns.
     if ((player->Flags & NETWORK_PLAYER_FLAG_ISSERVER) == 0)
     {
@@ -3174,6 +3387,8 @@ void Network::Server_Handle_GAME_ACTION(NetworkConnection& connection, NetworkPa
             if (cooldownIt->second > 0)
             {
                 Server_Send_SHOWERROR(connection, STR_CANT_DO_THIS, STR_NETWORK_ACTION_RATE_LIMIT_MESSAGE);
+                GameActionResult result(GA_ERROR::DISALLOWED, STR_CANT_DO_THIS, STR_NETWORK_ACTION_RATE_LIMIT_MESSAGE);
+                Server_Send_GAME_ACTION_REJECTED(connection, ga.get(), &result);
                 return;
             }
         }
@@ -3185,12 +3400,6 @@ void Network::Server_Handle_GAME_ACTION(NetworkConnection& connection, NetworkPa
         }
     }
 
-    DataSerialiser stream(false);
-    size_t size = packet.Size - packet.BytesRead;
-    stream.GetStream().WriteArray(packet.Read(size), size);
-    stream.GetStream().SetPosition(0);
-
-    ga->Serialise(stream);
     // Set player to sender, should be 0 if sent from client.
     ga->SetPlayer(NetworkPlayerId_t{ connection.Player->Id });
 
@@ -3447,6 +3656,11 @@ void network_flush()
     gNetwork.Flush();
 }
 
+bool network_wait_for_activity(uint32_t timeoutMs)
+{
+    return gNetwork.WaitForActivity(timeoutMs);
+}
+
 int32_t network_get_mode()
 {
     return gNetwork.GetMode();
@@ -3532,6 +3746,16 @@ std::string network_get_player_ip_address(uint32_t id)
     return {};
 }
 
+size_t network_get_player_queued_packet_count(uint32_t id)
+{
+    auto conn = gNetwork.GetPlayerConnection(id);
+    if (conn != nullptr)
+    {
+        return conn->GetQueuedPacketCount();
+    }
+    return 0;
+}
+
 std::string network_get_player_public_key_hash(uint32_t id)
 {
     auto player = gNetwork.GetPlayerByID(id);
@@ -4027,6 +4251,19 @@ void network_send_game_action(const GameAction* action)
     }
 }
 
+void network_send_game_action_rejected(const GameAction* action, const GameActionResult* result)
+{
+    if (gNetwork.GetMode() == NETWORK_MODE_SERVER)
+    {
+        // Actions run by the host have no connection to report back to.
+        auto connection = gNetwork.GetPlayerConnection(action->GetPlayer().id);
+        if (connection != nullptr)
+        {
+            gNetwork.Server_Send_GAME_ACTION_REJECTED(*connection, action, result);
+        }
+    }
+}
+
 void network_send_password(const std::string& password)
 {
     utf8 keyPath[MAX_PATH];
@@ -4127,6 +4364,16 @@ NetworkStats_t network_get_stats()
     return gNetwork.GetStats();
 }
 
+std::string network_get_metrics()
+{
+    return gNetwork.GetMetrics();
+}
+
+void network_record_tick_duration(double seconds)
+{
+    gNetwork.RecordTickDuration(seconds);
+}
+
 NetworkServerState_t network_get_server_state()
 {
     return gNetwork.GetServerState();
@@ -4161,6 +4408,10 @@ uint32_t network_get_server_tick()
 void network_flush()
 {
 }
+bool network_wait_for_activity(uint32_t timeoutMs)
+{
+    return false;
+}
 void network_send_tick()
 {
 }
@@ -4182,6 +4433,9 @@ void network_request_gamestate_snapshot()
 void network_send_game_action(const GameAction* action)
 {
 }
+void network_send_game_action_rejected(const GameAction* action, const GameActionResult* result)
+{
+}
 void network_send_map()
 {
 }
@@ -4227,6 +4481,10 @@ std::string network_get_player_ip_address(uint32_t id)
 {
     return {};
 }
+size_t network_get_player_queued_packet_count(uint32_t id)
+{
+    return 0;
+}
 std::string network_get_player_public_key_hash(uint32_t id)
 {
     return {};
@@ -4398,6 +4656,13 @@ NetworkStats_t network_get_stats()
 {
     return NetworkStats_t{};
 }
+std::string network_get_metrics()
+{
+    return {};
+}
+void network_record_tick_duration(double seconds)
+{
+}
 NetworkServerState_t network_get_server_state()
 {
     return NetworkServerState_t{};
@@ -11,12 +11,17 @@
 
 #    include "NetworkConnection.h"
 
+#    include "../Diagnostic.h"
 #    include "../core/String.hpp"
 #    include "../localisation/Localisation.h"
 #    include "../platform/platform.h"
 #    include "Socket.h"
 #    include "network.h"
 
+#    include <algorithm>
+#    include <cstring>
+#    include <iterator>
+
 constexpr size_t NETWORK_DISCONNECT_REASON_BUFFER_SIZE = 256;
 
 NetworkConnection::NetworkConnection()
@@ -29,13 +34,26 @@ NetworkConnection::~NetworkConnection()
     delete[] _lastDisconnectReason;
 }
 
+/**
+ * Returns the size of the length prefix of the inbound packet, which is only known once its first two bytes are read.
+ */
+size_t NetworkConnection::GetInboundHeaderSize() const
+{
+    if (InboundPacket.BytesTransferred >= NETWORK_PACKET_HEADER_SIZE && _inboundHeader[0] == 0 && _inboundHeader[1] == 0)
+    {
+        return NETWORK_PACKET_EXTENDED_HEADER_SIZE;
+    }
+    return NETWORK_PACKET_HEADER_SIZE;
+}
+
 int32_t NetworkConnection::ReadPacket()
 {
-    if (InboundPacket.BytesTransferred < sizeof(InboundPacket.Size))
+    size_t headerSize = GetInboundHeaderSize();
+    if (InboundPacket.BytesTransferred < headerSize)
     {
         // read packet size
-        void* buffer = &(reinterpret_cast<char*>(&InboundPacket.Size))[InboundPacket.BytesTransferred];
-        size_t bufferLength = sizeof(InboundPacket.Size) - InboundPacket.BytesTransferred;
+        void* buffer = &_inboundHeader[InboundPacket.BytesTransferred];
+        size_t bufferLength = headerSize - InboundPacket.BytesTransferred;
         size_t readBytes;
         NETWORK_READPACKET status = Socket->ReceiveData(buffer, bufferLength, &readBytes);
         if (status != NETWORK_READPACKET_SUCCESS)
@@ -44,12 +62,31 @@ int32_t NetworkConnection::ReadPacket()
         }
 
         InboundPacket.BytesTransferred += readBytes;
-        if (InboundPacket.BytesTransferred == sizeof(InboundPacket.Size))
+        if (InboundPacket.BytesTransferred == headerSize)
         {
-            InboundPacket.Size = Convert::NetworkToHost(InboundPacket.Size);
-            if (InboundPacket.Size == 0) // Can't have a size 0 packet
+            if (headerSize == NETWORK_PACKET_HEADER_SIZE)
             {
-                return NETWORK_READPACKET_DISCONNECTED;
+                uint16_t size;
+                std::memcpy(&size, _inboundHeader, sizeof(size));
+                InboundPacket.Size = ByteSwapBE(size);
+                if (InboundPacket.Size == 0)
+                {
+                    // The 32-bit size follows
+                    return NETWORK_READPACKET_MORE_DATA;
+                }
+            }
+            else
+            {
+                uint32_t size;
+                std::memcpy(&size, &_inboundHeader[NETWORK_PACKET_HEADER_SIZE], sizeof(size));
+                InboundPacket.Size = ByteSwapBE(size);
+
+                // Only the server sends large packets, and only once the client has been authenticated.
+                if (InboundPacket.Size == 0 || InboundPacket.Size > NETWORK_PACKET_MAX_SIZE
+                    || (network_get_mode() == NETWORK_MODE_SERVER && AuthStatus != NETWORK_AUTH_OK))
+                {
+                    return NETWORK_READPACKET_DISCONNECTED;
+                }
             }
             InboundPacket.Data->resize(InboundPacket.Size);
         }
@@ -59,8 +96,8 @@ int32_t NetworkConnection::ReadPacket()
         // read packet data
         if (InboundPacket.Data->capacity() > 0)
         {
-            void* buffer = &InboundPacket.GetData()[InboundPacket.BytesTransferred - sizeof(InboundPacket.Size)];
-            size_t bufferLength = sizeof(InboundPacket.Size) + InboundPacket.Size - InboundPacket.BytesTransferred;
+            void* buffer = &InboundPacket.GetData()[InboundPacket.BytesTransferred - headerSize];
+            size_t bufferLength = headerSize + InboundPacket.Size - InboundPacket.BytesTransferred;
             size_t readBytes;
             NETWORK_READPACKET status = Socket->ReceiveData(buffer, bufferLength, &readBytes);
             if (status != NETWORK_READPACKET_SUCCESS)
@@ -70,7 +107,7 @@ int32_t NetworkConnection::ReadPacket()
 
             InboundPacket.BytesTransferred += readBytes;
         }
-        if (InboundPacket.BytesTransferred == sizeof(InboundPacket.Size) + InboundPacket.Size)
+        if (InboundPacket.BytesTransferred == headerSize + InboundPacket.Size)
         {
             _lastPacketTime = platform_get_ticks();
 
@@ -82,35 +119,17 @@ int32_t NetworkConnection::ReadPacket()
     return NETWORK_READPACKET_MORE_DATA;
 }
 
-bool NetworkConnection::SendPacket(NetworkPacket& packet)
-{
-    uint16_t sizen = Convert::HostToNetwork(packet.Size);
-    std::vector<uint8_t> tosend;
-    tosend.reserve(sizeof(sizen) + packet.Size);
-    tosend.insert(tosend.end(), reinterpret_cast<uint8_t*>(&sizen), reinterpret_cast<uint8_t*>(&sizen) + sizeof(sizen));
-    tosend.insert(tosend.end(), packet.Data->begin(), packet.Data->end());
-
-    const void* buffer = &tosend[packet.BytesTransferred];
-    size_t bufferSize = tosend.size() - packet.BytesTransferred;
-    size_t sent = Socket->SendData(buffer, bufferSize);
-    if (sent > 0)
-    {
-        packet.BytesTransferred += sent;
-    }
-
-    bool sendComplete = packet.BytesTransferred == tosend.size();
-    if (sendComplete)
-    {
-        RecordPacketStats(packet, true);
-    }
-    return sendComplete;
-}
-
 void NetworkConnection::QueuePacket(std::unique_ptr<NetworkPacket> packet, bool front)
 {
     if (AuthStatus == NETWORK_AUTH_OK || !packet->CommandRequiresAuth())
     {
-        packet->Size = static_cast<uint16_t>(packet->Data->size());
+        if (packet->Data->size() > NETWORK_PACKET_MAX_SIZE)
+        {
+            log_error("Unable to send packet of %zu bytes, dropping it.", packet->Data->size());
+            return;
+        }
+
+        packet->Size = static_cast<uint32_t>(packet->Data->size());
         if (front)
         {
             // If the first packet was already partially sent add new packet to second position
@@ -134,12 +153,70 @@ void NetworkConnection::QueuePacket(std::unique_ptr<NetworkPacket> packet, bool
 
 void NetworkConnection::SendQueuedPackets()
 {
-    while (!_outboundPackets.empty() && SendPacket(*_outboundPackets.front()))
+    while (!_outboundPackets.empty())
     {
-        _outboundPackets.remove(_outboundPackets.front());
+        // Send the size prefix and data of as many packets as possible in one go, straight from the packet data.
+        SocketBuffer buffers[SOCKET_MAX_SEND_BUFFERS];
+        uint8_t headers[SOCKET_MAX_SEND_BUFFERS / 2][NETWORK_PACKET_EXTENDED_HEADER_SIZE];
+        size_t numBuffers = 0;
+        size_t numPackets = 0;
+        size_t bytesToSend = 0;
+        for (const auto& packet : _outboundPackets)
+        {
+            // A packet whose header has already been sent only takes one buffer, so the headers can run out first.
+            if (numBuffers + 2 > SOCKET_MAX_SEND_BUFFERS || numPackets >= std::size(headers))
+                break;
+
+            auto header = headers[numPackets++];
+            size_t headerSize = NetworkPacket::WriteHeader(header, packet->Size);
+
+            // Only the first packet can have been sent partially.
+            size_t offset = packet->BytesTransferred;
+            if (offset < headerSize)
+            {
+                buffers[numBuffers++] = { header + offset, headerSize - offset };
+                offset = 0;
+            }
+            else
+            {
+                offset -= headerSize;
+            }
+            if (offset < packet->Size)
+            {
+                buffers[numBuffers++] = { packet->GetData() + offset, packet->Size - offset };
+            }
+            bytesToSend += headerSize + packet->Size - packet->BytesTransferred;
+        }
+
+        size_t bytesSent = Socket->SendData(buffers, numBuffers);
+        size_t bytesRemaining = bytesSent;
+        while (bytesRemaining > 0)
+        {
+            auto& packet = *_outboundPackets.front();
+            size_t packetLength = NetworkPacket::GetHeaderSize(packet.Size) + packet.Size;
+            size_t packetBytes = std::min(bytesRemaining, packetLength - packet.BytesTransferred);
+            packet.BytesTransferred += packetBytes;
+            bytesRemaining -= packetBytes;
+            if (packet.BytesTransferred == packetLength)
+            {
+                RecordPacketStats(packet, true);
+                _outboundPackets.pop_front();
+            }
+        }
+
+        if (bytesSent < bytesToSend)
+        {
+            // The socket can not take any more for now.
+            break;
+        }
     }
 }
 
+size_t NetworkConnection::GetQueuedPacketCount() const
+{
+    return _outboundPackets.size();
+}
+
 void NetworkConnection::ResetLastPacketTime()
 {
     _lastPacketTime = platform_get_ticks();
@@ -189,7 +266,8 @@ void NetworkConnection::RecordPacketStats(const NetworkPacket& packet, bool send
     uint32_t packetSize = static_cast<uint32_t>(packet.BytesTransferred);
     uint32_t trafficGroup = NETWORK_STATISTICS_GROUP_BASE;
 
-    switch (packet.GetCommand())
+    auto command = packet.GetCommand();
+    switch (command)
     {
         case NETWORK_COMMAND_GAME_ACTION:
             trafficGroup = NETWORK_STATISTICS_GROUP_COMMANDS;
@@ -209,6 +287,20 @@ void NetworkConnection::RecordPacketStats(const NetworkPacket& packet, bool send
         Stats.bytesReceived[trafficGroup] += packetSize;
         Stats.bytesReceived[NETWORK_STATISTICS_GROUP_TOTAL] += packetSize;
     }
+
+    if (command >= 0 && command < NETWORK_COMMAND_MAX)
+    {
+        if (sending)
+        {
+            Stats.commandBytesSent[command] += packetSize;
+            Stats.commandPacketsSent[command]++;
+        }
+        else
+        {
+            Stats.commandBytesReceived[command] += packetSize;
+            Stats.commandPacketsReceived[command]++;
+        }
+    }
 }
 
 #endif
@@ -43,6 +43,7 @@ public:
     int32_t ReadPacket();
     void QueuePacket(std::unique_ptr<NetworkPacket> packet, bool front = false);
     void SendQueuedPackets();
+    size_t GetQueuedPacketCount() const;
     void ResetLastPacketTime();
     bool ReceivedPacketRecently();
 
@@ -52,11 +53,12 @@ public:
 
 private:
     std::list<std::unique_ptr<NetworkPacket>> _outboundPackets;
+    uint8_t _inboundHeader[NETWORK_PACKET_EXTENDED_HEADER_SIZE] = {};
     uint32_t _lastPacketTime = 0;
     utf8* _lastDisconnectReason = nullptr;
 
+    size_t GetInboundHeaderSize() const;
     void RecordPacketStats(const NetworkPacket& packet, bool sending);
-    bool SendPacket(NetworkPacket& packet);
 };
 
 #endif // DISABLE_NETWORK
@@ -0,0 +1,196 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+#    include "NetworkMetrics.h"
+
+#    include "../core/String.hpp"
+#    include "../platform/platform.h"
+#    include "Socket.h"
+#    include "network.h"
+
+#    include <vector>
+
+// Scrapers only send a short request, anything larger is not worth reading.
+constexpr size_t METRICS_MAX_REQUEST_SIZE = 8 * 1024;
+constexpr size_t METRICS_MAX_REQUESTS = 8;
+constexpr uint32_t METRICS_REQUEST_TIMEOUT = 5000;
+
+void TickDurationHistogram::Record(double seconds)
+{
+    for (size_t i = 0; i < BucketBounds.size(); i++)
+    {
+        if (seconds <= BucketBounds[i])
+        {
+            BucketCounts[i]++;
+        }
+    }
+    Count++;
+    Sum += seconds;
+}
+
+void MetricsWriter::Declare(const char* name, const char* type, const char* help)
+{
+    _text += String::StdFormat("# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+
+void MetricsWriter::Write(const char* name, double value)
+{
+    WriteSample(name, {}, value);
+}
+
+void MetricsWriter::Write(const char* name, const char* labelName, const std::string& labelValue, double value)
+{
+    std::string labels = labelName;
+    labels += "=\"";
+    for (auto c : labelValue)
+    {
+        switch (c)
+        {
+            case '\\':
+                labels += "\\\\";
+                break;
+            case '"':
+                labels += "\\\"";
+                break;
+            case '\n':
+                labels += "\\n";
+                break;
+            default:
+                labels += c;
+                break;
+        }
+    }
+    labels += "\"";
+    WriteSample(name, labels, value);
+}
+
+void MetricsWriter::Write(const char* name, const TickDurationHistogram& histogram)
+{
+    auto bucketName = std::string(name) + "_bucket";
+    for (size_t i = 0; i < histogram.BucketBounds.size(); i++)
+    {
+        auto labels = String::StdFormat("le=\"%g\"", histogram.BucketBounds[i]);
+        WriteSample(bucketName.c_str(), labels, static_cast<double>(histogram.BucketCounts[i]));
+    }
+    WriteSample(bucketName.c_str(), "le=\"+Inf\"", static_cast<double>(histogram.Count));
+    WriteSample((std::string(name) + "_sum").c_str(), {}, histogram.Sum);
+    WriteSample((std::string(name) + "_count").c_str(), {}, static_cast<double>(histogram.Count));
+}
+
+void MetricsWriter::WriteSample(const char* name, const std::string& labels, double value)
+{
+    _text += name;
+    if (!labels.empty())
+    {
+        _text += "{" + labels + "}";
+    }
+    _text += String::StdFormat(" %.17g\n", value);
+}
+
+class NetworkMetricsServer final : public INetworkMetricsServer
+{
+private:
+    struct MetricsRequest
+    {
+        std::unique_ptr<ITcpSocket> Socket;
+        std::string Request;
+        std::string Response;
+        size_t ResponseSent = 0;
+        uint32_t StartTime = 0;
+    };
+
+    std::unique_ptr<ITcpSocket> _listenSocket;
+    std::vector<MetricsRequest> _requests;
+
+public:
+    NetworkMetricsServer(const std::string& address, uint16_t port)
+    {
+        _listenSocket = CreateTcpSocket();
+        _listenSocket->Listen(address, port);
+    }
+
+    void Update() override
+    {
+        std::unique_ptr<ITcpSocket> socket;
+        while ((socket = _listenSocket->Accept()) != nullptr)
+        {
+            if (_requests.size() < METRICS_MAX_REQUESTS)
+            {
+                MetricsRequest request;
+                request.Socket = std::move(socket);
+                request.StartTime = platform_get_ticks();
+                _requests.push_back(std::move(request));
+            }
+        }
+
+        for (auto it = _requests.begin(); it != _requests.end();)
+        {
+            if (ProcessRequest(*it))
+            {
+                it++;
+            }
+            else
+            {
+                it->Socket->Close();
+                it = _requests.erase(it);
+            }
+        }
+    }
+
+private:
+    /**
+     * Reads the request, then sends the response over as many updates as the socket needs. Returns false once the
+     * request is finished with, whether it was answered or not.
+     */
+    bool ProcessRequest(MetricsRequest& request)
+    {
+        if (platform_get_ticks() - request.StartTime > METRICS_REQUEST_TIMEOUT)
+        {
+            return false;
+        }
+
+        if (request.Response.empty())
+        {
+            char buffer[1024];
+            size_t readBytes = 0;
+            auto status = request.Socket->ReceiveData(buffer, sizeof(buffer), &readBytes);
+            if (status == NETWORK_READPACKET_DISCONNECTED)
+            {
+                return false;
+            }
+            request.Request.append(buffer, readBytes);
+
+            // Any request is answered with the metrics, there is only one thing to serve.
+            if (request.Request.find("\r\n\r\n") == std::string::npos && request.Request.find("\n\n") == std::string::npos)
+            {
+                return request.Request.size() < METRICS_MAX_REQUEST_SIZE;
+            }
+
+            auto body = network_get_metrics();
+            request.Response = String::StdFormat(
+                "HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: %zu\r\n"
+                "Connection: close\r\n\r\n",
+                body.size());
+            request.Response += body;
+        }
+
+        auto remaining = request.Response.size() - request.ResponseSent;
+        request.ResponseSent += request.Socket->SendData(request.Response.data() + request.ResponseSent, remaining);
+        return request.ResponseSent < request.Response.size();
+    }
+};
+
+std::unique_ptr<INetworkMetricsServer> CreateMetricsServer(const std::string& address, uint16_t port)
+{
+    return std::make_unique<NetworkMetricsServer>(address, port);
+}
+
+#endif // DISABLE_NETWORK
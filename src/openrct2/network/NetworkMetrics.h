@@ -0,0 +1,66 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <array>
+#include <memory>
+#include <string>
+
+/**
+ * Counts how long game ticks take, using the cumulative buckets of a Prometheus histogram.
+ */
+struct TickDurationHistogram
+{
+    // Upper bounds in seconds, a tick has 25 ms at normal game speed.
+    static constexpr std::array<double, 8> BucketBounds = { 0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25 };
+
+    std::array<uint64_t, BucketBounds.size()> BucketCounts{};
+    uint64_t Count = 0;
+    double Sum = 0;
+
+    void Record(double seconds);
+};
+
+/**
+ * Builds text in the Prometheus exposition format.
+ */
+class MetricsWriter final
+{
+private:
+    std::string _text;
+
+public:
+    void Declare(const char* name, const char* type, const char* help);
+    void Write(const char* name, double value);
+    void Write(const char* name, const char* labelName, const std::string& labelValue, double value);
+    void Write(const char* name, const TickDurationHistogram& histogram);
+
+    const std::string& GetText() const
+    {
+        return _text;
+    }
+
+private:
+    void WriteSample(const char* name, const std::string& labels, double value);
+};
+
+/**
+ * Answers plain HTTP requests with the current metrics so that they can be scraped.
+ */
+interface INetworkMetricsServer
+{
+    virtual ~INetworkMetricsServer() = default;
+
+    virtual void Update() abstract;
+};
+
+std::unique_ptr<INetworkMetricsServer> CreateMetricsServer(const std::string& address, uint16_t port);
@@ -13,6 +13,8 @@
 
 #    include "NetworkTypes.h"
 
+#    include <cstring>
+#    include <limits>
 #    include <memory>
 
 std::unique_ptr<NetworkPacket> NetworkPacket::Allocate()
@@ -25,6 +27,27 @@ std::unique_ptr<NetworkPacket> NetworkPacket::Duplicate(NetworkPacket& packet)
     return std::make_unique<NetworkPacket>(packet);
 }
 
+size_t NetworkPacket::GetHeaderSize(uint32_t size)
+{
+    return size > std::numeric_limits<uint16_t>::max() ? NETWORK_PACKET_EXTENDED_HEADER_SIZE : NETWORK_PACKET_HEADER_SIZE;
+}
+
+size_t NetworkPacket::WriteHeader(uint8_t* header, uint32_t size)
+{
+    if (GetHeaderSize(size) == NETWORK_PACKET_HEADER_SIZE)
+    {
+        uint16_t shortSize = ByteSwapBE(static_cast<uint16_t>(size));
+        std::memcpy(header, &shortSize, sizeof(shortSize));
+        return NETWORK_PACKET_HEADER_SIZE;
+    }
+
+    uint16_t escape = 0;
+    uint32_t longSize = ByteSwapBE(size);
+    std::memcpy(header, &escape, sizeof(escape));
+    std::memcpy(header + sizeof(escape), &longSize, sizeof(longSize));
+    return NETWORK_PACKET_EXTENDED_HEADER_SIZE;
+}
+
 uint8_t* NetworkPacket::GetData()
 {
     return &(*Data)[0];
@@ -105,4 +128,59 @@ const utf8* NetworkPacket::ReadString()
     return str;
 }
 
+NetworkPacketStream::NetworkPacketStream(NetworkPacket& packet)
+    : _packet(packet)
+{
+}
+
+bool NetworkPacketStream::CanRead() const
+{
+    return false;
+}
+
+bool NetworkPacketStream::CanWrite() const
+{
+    return true;
+}
+
+uint64_t NetworkPacketStream::GetLength() const
+{
+    return _packet.Data->size();
+}
+
+uint64_t NetworkPacketStream::GetPosition() const
+{
+    return _packet.Data->size();
+}
+
+void NetworkPacketStream::SetPosition(uint64_t position)
+{
+    throw IOException("Packet streams can only be appended to.");
+}
+
+void NetworkPacketStream::Seek(int64_t offset, int32_t origin)
+{
+    throw IOException("Packet streams can only be appended to.");
+}
+
+void NetworkPacketStream::Read(void* buffer, uint64_t length)
+{
+    throw IOException("Packet streams can not be read from.");
+}
+
+void NetworkPacketStream::Write(const void* buffer, uint64_t length)
+{
+    _packet.Write(static_cast<const uint8_t*>(buffer), static_cast<size_t>(length));
+}
+
+uint64_t NetworkPacketStream::TryRead(void* buffer, uint64_t length)
+{
+    return 0;
+}
+
+const void* NetworkPacketStream::GetData() const
+{
+    return _packet.Data->data();
+}
+
 #endif
@@ -11,22 +11,41 @@
 
 #include "../common.h"
 #include "../core/DataSerialiser.h"
+#include "../core/IStream.hpp"
 #include "NetworkTypes.h"
 
 #include <memory>
 #include <vector>
 
+// Packets larger than the 16-bit length prefix allows are sent with a zero prefix followed by a 32-bit length.
+constexpr size_t NETWORK_PACKET_HEADER_SIZE = sizeof(uint16_t);
+constexpr size_t NETWORK_PACKET_EXTENDED_HEADER_SIZE = sizeof(uint16_t) + sizeof(uint32_t);
+constexpr uint32_t NETWORK_PACKET_MAX_SIZE = 64 * 1024 * 1024;
+
 class NetworkPacket final
 {
 public:
-    uint16_t Size = 0;
+    uint32_t Size = 0;
     std::shared_ptr<std::vector<uint8_t>> Data = std::make_shared<std::vector<uint8_t>>();
     size_t BytesTransferred = 0;
     size_t BytesRead = 0;
 
     static std::unique_ptr<NetworkPacket> Allocate();
+    /**
+     * Creates a packet that shares the data of the given one, so a packet can be queued on many connections without
+     * copying its data. The data must not be modified once the packet has been queued.
+     */
     static std::unique_ptr<NetworkPacket> Duplicate(NetworkPacket& packet);
 
+    /**
+     * Returns the number of bytes used by the length prefix of a packet of the given size.
+     */
+    static size_t GetHeaderSize(uint32_t size);
+    /**
+     * Writes the length prefix for a packet of the given size and returns the number of bytes written.
+     */
+    static size_t WriteHeader(uint8_t* header, uint32_t size);
+
     uint8_t* GetData();
     int32_t GetCommand() const;
 
@@ -69,3 +88,31 @@ public:
         return *this;
     }
 };
+
+/**
+ * A stream that appends everything written to it to the data of a packet, so a DataSerialiser can encode straight into
+ * the packet instead of into a buffer that is then copied. It can only be written to.
+ */
+class NetworkPacketStream final : public IStream
+{
+private:
+    NetworkPacket& _packet;
+
+public:
+    explicit NetworkPacketStream(NetworkPacket& packet);
+
+    bool CanRead() const override;
+    bool CanWrite() const override;
+
+    uint64_t GetLength() const override;
+    uint64_t GetPosition() const override;
+    void SetPosition(uint64_t position) override;
+    void Seek(int64_t offset, int32_t origin) override;
+
+    void Read(void* buffer, uint64_t length) override;
+    void Write(const void* buffer, uint64_t length) override;
+
+    uint64_t TryRead(void* buffer, uint64_t length) override;
+
+    const void* GetData() const override;
+};
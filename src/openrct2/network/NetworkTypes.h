@@ -13,6 +13,8 @@
 #include "../core/Endianness.h"
 #include "../ride/RideTypes.h"
 
+#include <iterator>
+
 enum
 {
     NETWORK_MODE_NONE,
@@ -69,12 +71,24 @@ enum NETWORK_COMMAND
     NETWORK_COMMAND_REQUEST_GAMESTATE,
     NETWORK_COMMAND_GAMESTATE,
     NETWORK_COMMAND_SCRIPTS,
+    NETWORK_COMMAND_GAME_ACTION_REJECTED,
     NETWORK_COMMAND_MAX,
     NETWORK_COMMAND_INVALID = -1
 };
 
 static_assert(NETWORK_COMMAND::NETWORK_COMMAND_GAMEINFO == 9, "Master server expects this to be 9");
 
+// Names used when reporting statistics by command.
+// clang-format off
+constexpr const char* NetworkCommandNames[] =
+{
+    "auth", "map", "chat", "unused", "tick", "playerlist", "ping", "pinglist", "setdisconnectmsg", "gameinfo", "showerror",
+    "grouplist", "event", "token", "objects", "game_action", "playerinfo", "request_gamestate", "gamestate", "scripts",
+    "game_action_rejected",
+};
+// clang-format on
+static_assert(std::size(NetworkCommandNames) == NETWORK_COMMAND_MAX);
+
 enum NETWORK_SERVER_STATE
 {
     NETWORK_SERVER_STATE_OK,
@@ -131,4 +145,10 @@ struct NetworkStats_t
 {
     uint64_t bytesReceived[NETWORK_STATISTICS_GROUP_MAX];
     uint64_t bytesSent[NETWORK_STATISTICS_GROUP_MAX];
+
+    // Per command totals, including the size prefix of each packet.
+    uint64_t commandBytesReceived[NETWORK_COMMAND_MAX];
+    uint64_t commandBytesSent[NETWORK_COMMAND_MAX];
+    uint64_t commandPacketsReceived[NETWORK_COMMAND_MAX];
+    uint64_t commandPacketsSent[NETWORK_COMMAND_MAX];
 };
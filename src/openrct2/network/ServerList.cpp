@@ -14,6 +14,7 @@
 #    include "../Context.h"
 #    include "../PlatformEnvironment.h"
 #    include "../config/Config.h"
+#    include "../core/BackgroundJobs.h"
 #    include "../core/FileStream.hpp"
 #    include "../core/Http.h"
 #    include "../core/Json.hpp"
@@ -230,25 +231,64 @@ bool ServerList::WriteFavourites(const std::vector<ServerListEntry>& entries) co
     }
 }
 
-std::future<std::vector<ServerListEntry>> ServerList::FetchLocalServerListAsync(const INetworkEndpoint& broadcastEndpoint) const
+static void AddLocalServerEntry(
+    std::vector<ServerListEntry>& entries, const char* buffer, const INetworkEndpoint& endpoint)
 {
-    auto broadcastAddress = broadcastEndpoint.GetHostname();
-    return std::async(std::launch::async, [broadcastAddress] {
-        constexpr auto RECV_DELAY_MS = 10;
-        constexpr auto RECV_WAIT_MS = 2000;
+    auto sender = endpoint.GetHostname();
+    auto jinfo = Json::FromString(std::string_view(buffer));
 
-        std::string_view msg = NETWORK_LAN_BROADCAST_MSG;
-        auto udpSocket = CreateUdpSocket();
+    auto ip4 = json_array();
+    json_array_append_new(ip4, json_string(sender.c_str()));
+    auto ip = json_object();
+    json_object_set_new(ip, "v4", ip4);
+    json_object_set_new(jinfo, "ip", ip);
 
-        log_verbose("Broadcasting %zu bytes to the LAN (%s)", msg.size(), broadcastAddress.c_str());
-        auto len = udpSocket->SendData(broadcastAddress, NETWORK_LAN_BROADCAST_PORT, msg.data(), msg.size());
-        if (len != msg.size())
+    auto entry = ServerListEntry::FromJson(jinfo);
+    if (entry.has_value())
+    {
+        (*entry).Local = true;
+        entries.push_back(*entry);
+    }
+
+    json_decref(jinfo);
+}
+
+/**
+ * Broadcasts a query on every LAN broadcast address and collects the replies. All sockets are polled from the calling
+ * thread so that discovery takes a single background job regardless of the number of network interfaces.
+ */
+static std::vector<ServerListEntry> FetchLocalServerList()
+{
+    constexpr auto RECV_DELAY_MS = 10;
+    constexpr auto RECV_WAIT_MS = 2000;
+
+    std::string_view msg = NETWORK_LAN_BROADCAST_MSG;
+    std::vector<std::unique_ptr<IUdpSocket>> udpSockets;
+    for (const auto& broadcastEndpoint : GetBroadcastAddresses())
+    {
+        auto broadcastAddress = broadcastEndpoint->GetHostname();
+        try
+        {
+            auto udpSocket = CreateUdpSocket();
+            log_verbose("Broadcasting %zu bytes to the LAN (%s)", msg.size(), broadcastAddress.c_str());
+            auto len = udpSocket->SendData(broadcastAddress, NETWORK_LAN_BROADCAST_PORT, msg.data(), msg.size());
+            if (len != msg.size())
+            {
+                throw std::runtime_error("Unable to broadcast server query.");
+            }
+            udpSockets.push_back(std::move(udpSocket));
+        }
+        catch (const std::exception& e)
         {
-            throw std::runtime_error("Unable to broadcast server query.");
+            // Ignore any errors from a particular broadcast address
+            log_warning("Error broadcasting to %s: %s", broadcastAddress.c_str(), e.what());
         }
+    }
 
-        std::vector<ServerListEntry> entries;
-        for (int i = 0; i < (RECV_WAIT_MS / RECV_DELAY_MS); i++)
+    std::vector<ServerListEntry> entries;
+    for (int i = 0; i < (RECV_WAIT_MS / RECV_DELAY_MS) && !udpSockets.empty(); i++)
+    {
+        for (auto& udpSocket : udpSockets)
         {
             try
             {
@@ -256,69 +296,39 @@ std::future<std::vector<ServerListEntry>> ServerList::FetchLocalServerListAsync(
                 char buffer[1024]{};
                 size_t recievedLen{};
                 std::unique_ptr<INetworkEndpoint> endpoint;
-                auto p = udpSocket->ReceiveData(buffer, sizeof(buffer) - 1, &recievedLen, &endpoint);
-                if (p == NETWORK_READPACKET_SUCCESS)
+                while (udpSocket->ReceiveData(buffer, sizeof(buffer) - 1, &recievedLen, &endpoint)
+                       == NETWORK_READPACKET_SUCCESS)
                 {
-                    auto sender = endpoint->GetHostname();
-                    log_verbose("Received %zu bytes back from %s", recievedLen, sender.c_str());
-                    auto jinfo = Json::FromString(std::string_view(buffer));
-
-                    auto ip4 = json_array();
-                    json_array_append_new(ip4, json_string(sender.c_str()));
-                    auto ip = json_object();
-                    json_object_set_new(ip, "v4", ip4);
-                    json_object_set_new(jinfo, "ip", ip);
-
-                    auto entry = ServerListEntry::FromJson(jinfo);
-                    if (entry.has_value())
-                    {
-                        (*entry).Local = true;
-                        entries.push_back(*entry);
-                    }
-
-                    json_decref(jinfo);
+                    log_verbose("Received %zu bytes back from %s", recievedLen, endpoint->GetHostname().c_str());
+                    buffer[recievedLen] = '\0';
+                    AddLocalServerEntry(entries, buffer, *endpoint);
                 }
             }
             catch (const std::exception& e)
             {
                 log_warning("Error receiving data: %s", e.what());
             }
-            platform_sleep(RECV_DELAY_MS);
         }
-        return entries;
-    });
+        platform_sleep(RECV_DELAY_MS);
+    }
+    return entries;
 }
 
 std::future<std::vector<ServerListEntry>> ServerList::FetchLocalServerListAsync() const
 {
-    return std::async(std::launch::async, [&] {
-        // Get all possible LAN broadcast addresses
-        auto broadcastEndpoints = GetBroadcastAddresses();
-
-        // Spin off a fetch for each broadcast address
-        std::vector<std::future<std::vector<ServerListEntry>>> futures;
-        for (const auto& broadcastEndpoint : broadcastEndpoints)
+    auto p = std::make_shared<std::promise<std::vector<ServerListEntry>>>();
+    auto f = p->get_future();
+    BackgroundJobs::Run([p] {
+        try
         {
-            auto f = FetchLocalServerListAsync(*broadcastEndpoint);
-            futures.push_back(std::move(f));
+            p->set_value(FetchLocalServerList());
         }
-
-        // Wait and merge all results
-        std::vector<ServerListEntry> mergedEntries;
-        for (auto& f : futures)
+        catch (...)
         {
-            try
-            {
-                auto entries = f.get();
-                mergedEntries.insert(mergedEntries.begin(), entries.begin(), entries.end());
-            }
-            catch (...)
-            {
-                // Ignore any exceptions from a particular broadcast fetch
-            }
+            p->set_exception(std::current_exception());
         }
-        return mergedEntries;
     });
+    return f;
 }
 
 std::future<std::vector<ServerListEntry>> ServerList::FetchOnlineServerListAsync() const
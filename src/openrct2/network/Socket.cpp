@@ -9,11 +9,14 @@
 
 #ifndef DISABLE_NETWORK
 
+#    include "../core/BackgroundJobs.h"
+
 #    include <atomic>
 #    include <chrono>
 #    include <cmath>
 #    include <cstring>
 #    include <future>
+#    include <memory>
 #    include <string>
 #    include <thread>
 
@@ -44,8 +47,10 @@
     #include <netdb.h>
     #include <netinet/in.h>
     #include <netinet/tcp.h>
+    #include <poll.h>
     #include <sys/ioctl.h>
     #include <sys/socket.h>
+    #include <sys/uio.h>
     #include "../common.h"
     using SOCKET = int32_t;
     #define SOCKET_ERROR -1
@@ -204,6 +209,15 @@ private:
     std::string _ipAddress;
     std::string _hostName;
     std::future<void> _connectFuture;
+    std::atomic<bool> _connectCancelled = ATOMIC_VAR_INIT(false);
+
+    // Shared with the connect job, whichever of the job and CancelConnect claims it first completes the barrier.
+    struct ConnectJob
+    {
+        std::promise<void> Barrier;
+        std::atomic<bool> Claimed = ATOMIC_VAR_INIT(false);
+    };
+    std::shared_ptr<ConnectJob> _connectJob;
     std::string _error;
 
 public:
@@ -211,10 +225,7 @@ public:
 
     ~TcpSocket() override
     {
-        if (_connectFuture.valid())
-        {
-            _connectFuture.wait();
-        }
+        CancelConnect();
         CloseSocket();
     }
 
@@ -223,6 +234,11 @@ public:
         return _status;
     }
 
+    SOCKET GetSocket() const
+    {
+        return _socket;
+    }
+
     const char* GetError() const override
     {
         return _error.empty() ? nullptr : _error.c_str();
@@ -350,90 +366,7 @@ public:
         {
             throw std::runtime_error("Socket not closed.");
         }
-
-        try
-        {
-            // Resolve address
-            _status = SOCKET_STATUS_RESOLVING;
-
-            sockaddr_storage ss{};
-            socklen_t ss_len;
-            if (!ResolveAddress(address, port, &ss, &ss_len))
-            {
-                throw SocketException("Unable to resolve address.");
-            }
-
-            _status = SOCKET_STATUS_CONNECTING;
-            _socket = socket(ss.ss_family, SOCK_STREAM, IPPROTO_TCP);
-            if (_socket == INVALID_SOCKET)
-            {
-                throw SocketException("Unable to create socket.");
-            }
-
-            SetOption(_socket, IPPROTO_TCP, TCP_NODELAY, true);
-            if (!SetNonBlocking(_socket, true))
-            {
-                throw SocketException("Failed to set non-blocking mode.");
-            }
-
-            // Connect
-            int32_t connectResult = connect(_socket, reinterpret_cast<sockaddr*>(&ss), ss_len);
-            if (connectResult != SOCKET_ERROR || (LAST_SOCKET_ERROR() != EINPROGRESS && LAST_SOCKET_ERROR() != EWOULDBLOCK))
-            {
-                throw SocketException("Failed to connect.");
-            }
-
-            auto connectStartTime = std::chrono::system_clock::now();
-
-            int32_t error = 0;
-            socklen_t len = sizeof(error);
-            if (getsockopt(_socket, SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&error), &len) != 0)
-            {
-                throw SocketException("getsockopt failed with error: " + std::to_string(LAST_SOCKET_ERROR()));
-            }
-            if (error != 0)
-            {
-                throw SocketException("Connection failed: " + std::to_string(error));
-            }
-
-            do
-            {
-                // Sleep for a bit
-                std::this_thread::sleep_for(std::chrono::milliseconds(100));
-
-                fd_set writeFD;
-                FD_ZERO(&writeFD);
-#    pragma warning(push)
-#    pragma warning(disable : 4548) // expression before comma has no effect; expected expression with side-effect
-                FD_SET(_socket, &writeFD);
-#    pragma warning(pop)
-                timeval timeout{};
-                timeout.tv_sec = 0;
-                timeout.tv_usec = 0;
-                if (select(static_cast<int32_t>(_socket + 1), nullptr, &writeFD, nullptr, &timeout) > 0)
-                {
-                    error = 0;
-                    len = sizeof(error);
-                    if (getsockopt(_socket, SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&error), &len) != 0)
-                    {
-                        throw SocketException("getsockopt failed with error: " + std::to_string(LAST_SOCKET_ERROR()));
-                    }
-                    if (error == 0)
-                    {
-                        _status = SOCKET_STATUS_CONNECTED;
-                        return;
-                    }
-                }
-            } while ((std::chrono::system_clock::now() - connectStartTime) < CONNECT_TIMEOUT);
-
-            // Connection request timed out
-            throw SocketException("Connection timed out.");
-        }
-        catch (const std::exception&)
-        {
-            CloseSocket();
-            throw;
-        }
+        ConnectInternal(address, port);
     }
 
     void ConnectAsync(const std::string& address, uint16_t port) override
@@ -443,23 +376,30 @@ public:
             throw std::runtime_error("Socket not closed.");
         }
 
-        auto saddress = std::string(address);
-        std::promise<void> barrier;
-        _connectFuture = barrier.get_future();
-        auto thread = std::thread(
-            [this, saddress, port](std::promise<void> barrier2) -> void {
+        // Report resolving straight away, the job may wait in the queue for a while before it starts.
+        _status = SOCKET_STATUS_RESOLVING;
+        _connectCancelled = false;
+        auto job = std::make_shared<ConnectJob>();
+        _connectJob = job;
+        _connectFuture = job->Barrier.get_future();
+        BackgroundJobs::Run(
+            [this, address, port, job]() -> void {
+                if (job->Claimed.exchange(true))
+                {
+                    // Cancelled while queued, the socket may no longer exist.
+                    return;
+                }
                 try
                 {
-                    Connect(saddress.c_str(), port);
+                    ConnectInternal(address, port);
                 }
                 catch (const std::exception& ex)
                 {
                     _error = std::string(ex.what());
                 }
-                barrier2.set_value();
+                job->Barrier.set_value();
             },
-            std::move(barrier));
-        thread.detach();
+            BackgroundJobs::Kind::Connect);
     }
 
     void Disconnect() override
@@ -492,6 +432,49 @@ public:
         return totalSent;
     }
 
+    size_t SendData(const SocketBuffer* buffers, size_t count) override
+    {
+        if (_status != SOCKET_STATUS_CONNECTED)
+        {
+            throw std::runtime_error("Socket not connected.");
+        }
+        if (count > SOCKET_MAX_SEND_BUFFERS)
+        {
+            throw std::invalid_argument("Too many buffers.");
+        }
+
+#    ifdef _WIN32
+        WSABUF wsaBuffers[SOCKET_MAX_SEND_BUFFERS];
+        for (size_t i = 0; i < count; i++)
+        {
+            wsaBuffers[i].buf = static_cast<CHAR*>(const_cast<void*>(buffers[i].Data));
+            wsaBuffers[i].len = static_cast<ULONG>(buffers[i].Size);
+        }
+        DWORD sentBytes = 0;
+        if (WSASend(_socket, wsaBuffers, static_cast<DWORD>(count), &sentBytes, 0, nullptr, nullptr) == SOCKET_ERROR)
+        {
+            return 0;
+        }
+        return sentBytes;
+#    else
+        iovec ioBuffers[SOCKET_MAX_SEND_BUFFERS];
+        for (size_t i = 0; i < count; i++)
+        {
+            ioBuffers[i].iov_base = const_cast<void*>(buffers[i].Data);
+            ioBuffers[i].iov_len = buffers[i].Size;
+        }
+        msghdr message{};
+        message.msg_iov = ioBuffers;
+        message.msg_iovlen = count;
+        auto sentBytes = sendmsg(_socket, &message, FLAG_NO_PIPE);
+        if (sentBytes == SOCKET_ERROR)
+        {
+            return 0;
+        }
+        return static_cast<size_t>(sentBytes);
+#    endif
+    }
+
     NETWORK_READPACKET ReceiveData(void* buffer, size_t size, size_t* sizeReceived) override
     {
         if (_status != SOCKET_STATUS_CONNECTED)
@@ -538,10 +521,7 @@ public:
 
     void Close() override
     {
-        if (_connectFuture.valid())
-        {
-            _connectFuture.wait();
-        }
+        CancelConnect();
         CloseSocket();
     }
 
@@ -556,6 +536,119 @@ public:
     }
 
 private:
+    /**
+     * Stops a pending asynchronous connect. A connect that has not started yet is dropped straight away, one that is
+     * running is stopped at the next opportunity and waited for.
+     */
+    void CancelConnect()
+    {
+        if (_connectFuture.valid())
+        {
+            _connectCancelled = true;
+            if (!_connectJob->Claimed.exchange(true))
+            {
+                _status = SOCKET_STATUS_CLOSED;
+                _error = "Connection cancelled.";
+                _connectJob->Barrier.set_value();
+            }
+            _connectFuture.wait();
+            _connectFuture = {};
+            _connectJob = nullptr;
+        }
+    }
+
+    void ConnectInternal(const std::string& address, uint16_t port)
+    {
+        try
+        {
+            // Resolve address
+            _status = SOCKET_STATUS_RESOLVING;
+
+            sockaddr_storage ss{};
+            socklen_t ss_len;
+            if (!ResolveAddress(address, port, &ss, &ss_len))
+            {
+                throw SocketException("Unable to resolve address.");
+            }
+
+            _status = SOCKET_STATUS_CONNECTING;
+            _socket = socket(ss.ss_family, SOCK_STREAM, IPPROTO_TCP);
+            if (_socket == INVALID_SOCKET)
+            {
+                throw SocketException("Unable to create socket.");
+            }
+
+            SetOption(_socket, IPPROTO_TCP, TCP_NODELAY, true);
+            if (!SetNonBlocking(_socket, true))
+            {
+                throw SocketException("Failed to set non-blocking mode.");
+            }
+
+            // Connect
+            int32_t connectResult = connect(_socket, reinterpret_cast<sockaddr*>(&ss), ss_len);
+            if (connectResult != SOCKET_ERROR || (LAST_SOCKET_ERROR() != EINPROGRESS && LAST_SOCKET_ERROR() != EWOULDBLOCK))
+            {
+                throw SocketException("Failed to connect.");
+            }
+
+            auto connectStartTime = std::chrono::system_clock::now();
+
+            int32_t error = 0;
+            socklen_t len = sizeof(error);
+            if (getsockopt(_socket, SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&error), &len) != 0)
+            {
+                throw SocketException("getsockopt failed with error: " + std::to_string(LAST_SOCKET_ERROR()));
+            }
+            if (error != 0)
+            {
+                throw SocketException("Connection failed: " + std::to_string(error));
+            }
+
+            do
+            {
+                // Sleep for a bit
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+                fd_set writeFD;
+                FD_ZERO(&writeFD);
+#    pragma warning(push)
+#    pragma warning(disable : 4548) // expression before comma has no effect; expected expression with side-effect
+                FD_SET(_socket, &writeFD);
+#    pragma warning(pop)
+                timeval timeout{};
+                timeout.tv_sec = 0;
+                timeout.tv_usec = 0;
+                if (select(static_cast<int32_t>(_socket + 1), nullptr, &writeFD, nullptr, &timeout) > 0)
+                {
+                    error = 0;
+                    len = sizeof(error);
+                    if (getsockopt(_socket, SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&error), &len) != 0)
+                    {
+                        throw SocketException("getsockopt failed with error: " + std::to_string(LAST_SOCKET_ERROR()));
+                    }
+                    if (error == 0)
+                    {
+                        _status = SOCKET_STATUS_CONNECTED;
+                        return;
+                    }
+                }
+            } while ((std::chrono::system_clock::now() - connectStartTime) < CONNECT_TIMEOUT && !_connectCancelled);
+
+            if (_connectCancelled)
+            {
+                throw SocketException("Connection cancelled.");
+            }
+
+            // Connection request timed out
+            throw SocketException("Connection timed out.");
+        }
+        catch (const std::exception&)
+        {
+            CloseSocket();
+            throw;
+        }
+    }
+
     explicit TcpSocket(SOCKET socket, const std::string& hostName, const std::string& ipAddress)
     {
         _socket = socket;
@@ -850,6 +943,36 @@ std::unique_ptr<IUdpSocket> CreateUdpSocket()
     return std::make_unique<UdpSocket>();
 }
 
+bool WaitForSocketActivity(const std::vector<const ITcpSocket*>& sockets, uint32_t timeoutMs)
+{
+    std::vector<pollfd> pollSockets;
+    pollSockets.reserve(sockets.size());
+    for (auto socket : sockets)
+    {
+        auto tcpSocket = dynamic_cast<const TcpSocket*>(socket);
+        if (tcpSocket != nullptr && tcpSocket->GetSocket() != INVALID_SOCKET)
+        {
+            pollfd pollSocket{};
+            pollSocket.fd = tcpSocket->GetSocket();
+            pollSocket.events = POLLIN;
+            pollSockets.push_back(pollSocket);
+        }
+    }
+
+    if (pollSockets.empty())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMs));
+        return false;
+    }
+
+#    ifdef _WIN32
+    int32_t result = WSAPoll(pollSockets.data(), static_cast<ULONG>(pollSockets.size()), static_cast<INT>(timeoutMs));
+#    else
+    int32_t result = poll(pollSockets.data(), pollSockets.size(), static_cast<int32_t>(timeoutMs));
+#    endif
+    return result > 0;
+}
+
 #    ifdef _WIN32
 static std::vector<INTERFACE_INFO> GetNetworkInterfaces()
 {
@@ -32,6 +32,20 @@ enum NETWORK_READPACKET
     NETWORK_READPACKET_DISCONNECTED
 };
 
+/**
+ * A block of memory to send, see ITcpSocket::SendData.
+ */
+struct SocketBuffer
+{
+    const void* Data;
+    size_t Size;
+};
+
+/**
+ * The maximum number of buffers that can be passed to a single ITcpSocket::SendData call.
+ */
+constexpr size_t SOCKET_MAX_SEND_BUFFERS = 64;
+
 /**
  * Represents an address and port.
  */
@@ -65,6 +79,11 @@ public:
     virtual void ConnectAsync(const std::string& address, uint16_t port) abstract;
 
     virtual size_t SendData(const void* buffer, size_t size) abstract;
+    /**
+     * Sends as much of the given buffers as the socket accepts without blocking, in order, using a single system call.
+     * Returns the number of bytes sent.
+     */
+    virtual size_t SendData(const SocketBuffer* buffers, size_t count) abstract;
     virtual NETWORK_READPACKET ReceiveData(void* buffer, size_t size, size_t* sizeReceived) abstract;
 
     virtual void Disconnect() abstract;
@@ -100,6 +119,12 @@ std::unique_ptr<ITcpSocket> CreateTcpSocket();
 std::unique_ptr<IUdpSocket> CreateUdpSocket();
 std::vector<std::unique_ptr<INetworkEndpoint>> GetBroadcastAddresses();
 
+/**
+ * Blocks until one of the given sockets has data to read or a connection to accept, or until the timeout expires.
+ * Returns true if any of the sockets is ready.
+ */
+bool WaitForSocketActivity(const std::vector<const ITcpSocket*>& sockets, uint32_t timeoutMs);
+
 namespace Convert
 {
     uint16_t HostToNetwork(uint16_t value);
@@ -52,6 +52,7 @@ bool network_gamestate_snapshots_enabled();
 void network_update();
 void network_process_pending();
 void network_flush();
+bool network_wait_for_activity(uint32_t timeoutMs);
 
 int32_t network_get_authstatus();
 uint32_t network_get_server_tick();
@@ -63,6 +64,7 @@ int32_t network_get_player_ping(uint32_t index);
 int32_t network_get_player_id(uint32_t index);
 money32 network_get_player_money_spent(uint32_t index);
 std::string network_get_player_ip_address(uint32_t id);
+size_t network_get_player_queued_packet_count(uint32_t id);
 std::string network_get_player_public_key_hash(uint32_t id);
 void network_add_player_money_spent(uint32_t index, money32 cost);
 int32_t network_get_player_last_action(uint32_t index, int32_t time);
@@ -97,6 +99,7 @@ int32_t network_get_pickup_peep_old_x(uint8_t playerid);
 void network_send_map();
 void network_send_chat(const char* text, const std::vector<uint8_t>& playerIds = {});
 void network_send_game_action(const GameAction* action);
+void network_send_game_action_rejected(const GameAction* action, const GameActionResult* result);
 void network_enqueue_game_action(const GameAction* action);
 void network_send_password(const std::string& password);
 
@@ -115,5 +118,7 @@ const utf8* network_get_server_provider_website();
 std::string network_get_version();
 
 NetworkStats_t network_get_stats();
+std::string network_get_metrics();
+void network_record_tick_duration(double seconds);
 NetworkServerState_t network_get_server_state();
 json_t* network_get_server_info_as_json();
@@ -38,6 +38,8 @@
 #include "RideObject.h"
 
 #include <algorithm>
+#include <chrono>
+#include <future>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -211,9 +213,10 @@ private:
 class ObjectRepository final : public IObjectRepository
 {
     std::shared_ptr<IPlatformEnvironment> const _env;
-    ObjectFileIndex const _fileIndex;
+    ObjectFileIndex _fileIndex;
     std::vector<ObjectRepositoryItem> _items;
     ObjectEntryMap _itemMap;
+    std::future<std::vector<ObjectRepositoryItem>> _refreshResult;
 
 public:
     explicit ObjectRepository(const std::shared_ptr<IPlatformEnvironment>& env)
@@ -224,6 +227,10 @@ public:
 
     ~ObjectRepository() final
     {
+        if (_refreshResult.valid())
+        {
+            _refreshResult.wait();
+        }
         ClearItems();
     }
 
@@ -242,6 +249,41 @@ public:
         SortItems();
     }
 
+    void StartWatching() override
+    {
+        _fileIndex.StartWatching();
+    }
+
+    void Refresh(int32_t language) override
+    {
+        if (!_refreshResult.valid())
+        {
+            if (_fileIndex.TakePendingChanges())
+            {
+                // Scan and index on a background thread, the repository is only changed below on the calling thread.
+                _refreshResult = std::async(
+                    std::launch::async, [this, language] { return _fileIndex.LoadOrBuild(language); });
+            }
+            return;
+        }
+        if (_refreshResult.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            return;
+        }
+
+        // Existing items may be referenced by loaded objects or an object selection,
+        // so only append objects that are new to the repository without resorting.
+        auto items = _refreshResult.get();
+        for (const auto& item : items)
+        {
+            if (FindObject(&item.ObjectEntry) == nullptr)
+            {
+                log_verbose("Adding object: '%s'", item.Path.c_str());
+                AddItem(item);
+            }
+        }
+    }
+
     size_t GetNumObjects() const override
     {
         return _items.size();
@@ -65,6 +65,8 @@ interface IObjectRepository
 
     virtual void LoadOrConstruct(int32_t language) abstract;
     virtual void Construct(int32_t language) abstract;
+    virtual void StartWatching() abstract;
+    virtual void Refresh(int32_t language) abstract;
     virtual size_t GetNumObjects() const abstract;
     virtual const ObjectRepositoryItem* GetObjects() const abstract;
     virtual const ObjectRepositoryItem* FindObject(const std::string_view& legacyIdentifier) const abstract;
@@ -16,6 +16,7 @@
 #include "Ride.h"
 #include "RideData.h"
 #include "Track.h"
+#include "TrackGraph.h"
 #include "VehicleData.h"
 
 #include <algorithm>
@@ -82,24 +83,24 @@ Vehicle* cable_lift_segment_create(
     return current;
 }
 
-void Vehicle::CableLiftUpdate()
+void Vehicle::CableLiftUpdate(VehicleMotionContext& motion)
 {
     switch (status)
     {
         case VEHICLE_STATUS_MOVING_TO_END_OF_STATION:
-            CableLiftUpdateMovingToEndOfStation();
+            CableLiftUpdateMovingToEndOfStation(motion);
             break;
         case VEHICLE_STATUS_WAITING_FOR_PASSENGERS:
             // Stays in this state until a train puts it into next state
             break;
         case VEHICLE_STATUS_WAITING_TO_DEPART:
-            CableLiftUpdateWaitingToDepart();
+            CableLiftUpdateWaitingToDepart(motion);
             break;
         case VEHICLE_STATUS_DEPARTING:
             CableLiftUpdateDeparting();
             break;
         case VEHICLE_STATUS_TRAVELLING:
-            CableLiftUpdateTravelling();
+            CableLiftUpdateTravelling(motion);
             break;
         case VEHICLE_STATUS_ARRIVING:
             CableLiftUpdateArriving();
@@ -113,7 +114,7 @@ void Vehicle::CableLiftUpdate()
  *
  *  rct2: 0x006DF8A4
  */
-void Vehicle::CableLiftUpdateMovingToEndOfStation()
+void Vehicle::CableLiftUpdateMovingToEndOfStation(VehicleMotionContext& motion)
 {
     if (velocity >= -439800)
         acceleration = -2932;
@@ -124,7 +125,7 @@ void Vehicle::CableLiftUpdateMovingToEndOfStation()
         acceleration = 0;
     }
 
-    if (!(CableLiftUpdateTrackMotion() & VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION))
+    if (!(CableLiftUpdateTrackMotion(motion) & VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION))
         return;
 
     velocity = 0;
@@ -136,7 +137,7 @@ void Vehicle::CableLiftUpdateMovingToEndOfStation()
  *
  *  rct2: 0x006DF8F1
  */
-void Vehicle::CableLiftUpdateWaitingToDepart()
+void Vehicle::CableLiftUpdateWaitingToDepart(VehicleMotionContext& motion)
 {
     if (velocity >= -58640)
         acceleration = -14660;
@@ -147,7 +148,7 @@ void Vehicle::CableLiftUpdateWaitingToDepart()
         acceleration = 0;
     }
 
-    CableLiftUpdateTrackMotion();
+    CableLiftUpdateTrackMotion(motion);
 
     // Next check to see if the second part of the cable lift
     // is at the front of the passenger vehicle to simulate the
@@ -185,7 +186,7 @@ void Vehicle::CableLiftUpdateDeparting()
  *
  *  rct2: 0x006DF99C
  */
-void Vehicle::CableLiftUpdateTravelling()
+void Vehicle::CableLiftUpdateTravelling(VehicleMotionContext& motion)
 {
     Vehicle* passengerVehicle = GET_VEHICLE(cable_lift_target);
 
@@ -194,7 +195,7 @@ void Vehicle::CableLiftUpdateTravelling()
     if (passengerVehicle->HasUpdateFlag(VEHICLE_UPDATE_FLAG_BROKEN_TRAIN))
         return;
 
-    if (!(CableLiftUpdateTrackMotion() & VEHICLE_UPDATE_MOTION_TRACK_FLAG_1))
+    if (!(CableLiftUpdateTrackMotion(motion) & VEHICLE_UPDATE_MOTION_TRACK_FLAG_1))
         return;
 
     velocity = 0;
@@ -213,18 +214,18 @@ void Vehicle::CableLiftUpdateArriving()
         SetState(VEHICLE_STATUS_MOVING_TO_END_OF_STATION, sub_state);
 }
 
-bool Vehicle::CableLiftUpdateTrackMotionForwards()
+bool Vehicle::CableLiftUpdateTrackMotionForwards(VehicleMotionContext& motion)
 {
     auto curRide = get_ride(ride);
     if (curRide == nullptr)
         return false;
 
-    for (; remaining_distance >= 13962; _vehicleUnkF64E10++)
+    for (; remaining_distance >= 13962; motion.UnkF64E10++)
     {
         uint8_t trackType = GetTrackType();
         if (trackType == TRACK_ELEM_CABLE_LIFT_HILL && track_progress == 160)
         {
-            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_1;
+            motion.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_1;
         }
 
         uint16_t trackProgress = track_progress + 1;
@@ -232,21 +233,21 @@ bool Vehicle::CableLiftUpdateTrackMotionForwards()
         uint16_t trackTotalProgress = GetTrackProgress();
         if (trackProgress >= trackTotalProgress)
         {
-            _vehicleVAngleEndF64E36 = TrackDefinitions[trackType].vangle_end;
-            _vehicleBankEndF64E37 = TrackDefinitions[trackType].bank_end;
-            TileElement* trackElement = map_get_track_element_at_of_type_seq(TrackLocation, trackType, 0);
+            motion.VAngleEndF64E36 = TrackDefinitions[trackType].vangle_end;
+            motion.BankEndF64E37 = TrackDefinitions[trackType].bank_end;
+            TrackGraphCursor input = track_graph_get_piece(ride, TrackLocation, trackType);
 
-            CoordsXYE output;
+            TrackGraphCursor next;
             int32_t outputZ;
             int32_t outputDirection;
 
-            auto input = CoordsXYE{ TrackLocation, trackElement };
-
-            if (!track_block_get_next(&input, &output, &outputZ, &outputDirection))
+            if (!track_graph_get_next(input, &next, &outputZ, &outputDirection))
                 return false;
 
-            if (TrackDefinitions[output.element->AsTrack()->GetTrackType()].vangle_start != _vehicleVAngleEndF64E36
-                || TrackDefinitions[output.element->AsTrack()->GetTrackType()].bank_start != _vehicleBankEndF64E37)
+            const CoordsXYE& output = next.Element;
+
+            if (TrackDefinitions[output.element->AsTrack()->GetTrackType()].vangle_start != motion.VAngleEndF64E36
+                || TrackDefinitions[output.element->AsTrack()->GetTrackType()].bank_start != motion.BankEndF64E37)
                 return false;
 
             TrackLocation = { output, outputZ };
@@ -261,17 +262,17 @@ bool Vehicle::CableLiftUpdateTrackMotionForwards()
 
         uint8_t bx = 0;
         unk.z += RideTypeDescriptors[curRide->type].Heights.VehicleZOffset;
-        if (unk.x != unk_F64E20.x)
+        if (unk.x != motion.UnkF64E20.x)
             bx |= (1 << 0);
-        if (unk.y != unk_F64E20.y)
+        if (unk.y != motion.UnkF64E20.y)
             bx |= (1 << 1);
-        if (unk.z != unk_F64E20.z)
+        if (unk.z != motion.UnkF64E20.z)
             bx |= (1 << 2);
 
         remaining_distance -= dword_9A2930[bx];
-        unk_F64E20.x = unk.x;
-        unk_F64E20.y = unk.y;
-        unk_F64E20.z = unk.z;
+        motion.UnkF64E20.x = unk.x;
+        motion.UnkF64E20.y = unk.y;
+        motion.UnkF64E20.z = unk.z;
 
         sprite_direction = moveInfo->direction;
         bank_rotation = moveInfo->bank_rotation;
@@ -285,32 +286,30 @@ bool Vehicle::CableLiftUpdateTrackMotionForwards()
     return true;
 }
 
-bool Vehicle::CableLiftUpdateTrackMotionBackwards()
+bool Vehicle::CableLiftUpdateTrackMotionBackwards(VehicleMotionContext& motion)
 {
     auto curRide = get_ride(ride);
     if (curRide == nullptr)
         return false;
 
-    for (; remaining_distance < 0; _vehicleUnkF64E10++)
+    for (; remaining_distance < 0; motion.UnkF64E10++)
     {
         uint16_t trackProgress = track_progress - 1;
 
         if (static_cast<int16_t>(trackProgress) == -1)
         {
             uint8_t trackType = GetTrackType();
-            _vehicleVAngleEndF64E36 = TrackDefinitions[trackType].vangle_start;
-            _vehicleBankEndF64E37 = TrackDefinitions[trackType].bank_start;
-
-            TileElement* trackElement = map_get_track_element_at_of_type_seq(TrackLocation, trackType, 0);
+            motion.VAngleEndF64E36 = TrackDefinitions[trackType].vangle_start;
+            motion.BankEndF64E37 = TrackDefinitions[trackType].bank_start;
 
-            auto input = CoordsXYE{ TrackLocation, trackElement };
+            TrackGraphCursor input = track_graph_get_piece(ride, TrackLocation, trackType);
             track_begin_end output;
 
-            if (!track_block_get_previous(input, &output))
+            if (!track_graph_get_previous(input, &output, nullptr))
                 return false;
 
-            if (TrackDefinitions[output.begin_element->AsTrack()->GetTrackType()].vangle_end != _vehicleVAngleEndF64E36
-                || TrackDefinitions[output.begin_element->AsTrack()->GetTrackType()].bank_end != _vehicleBankEndF64E37)
+            const auto& trackDef = TrackDefinitions[output.begin_element->AsTrack()->GetTrackType()];
+            if (trackDef.vangle_end != motion.VAngleEndF64E36 || trackDef.bank_end != motion.BankEndF64E37)
                 return false;
 
             TrackLocation = { output.begin_x, output.begin_y, output.begin_z };
@@ -319,7 +318,7 @@ bool Vehicle::CableLiftUpdateTrackMotionBackwards()
 
             if (output.begin_element->AsTrack()->GetTrackType() == TRACK_ELEM_END_STATION)
             {
-                _vehicleMotionTrackFlags = VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
+                motion.MotionTrackFlags = VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
             }
 
             uint16_t trackTotalProgress = GetTrackProgress();
@@ -331,17 +330,17 @@ bool Vehicle::CableLiftUpdateTrackMotionBackwards()
 
         uint8_t bx = 0;
         unk.z += RideTypeDescriptors[curRide->type].Heights.VehicleZOffset;
-        if (unk.x != unk_F64E20.x)
+        if (unk.x != motion.UnkF64E20.x)
             bx |= (1 << 0);
-        if (unk.y != unk_F64E20.y)
+        if (unk.y != motion.UnkF64E20.y)
             bx |= (1 << 1);
-        if (unk.z != unk_F64E20.z)
+        if (unk.z != motion.UnkF64E20.z)
             bx |= (1 << 2);
 
         remaining_distance += dword_9A2930[bx];
-        unk_F64E20.x = unk.x;
-        unk_F64E20.y = unk.y;
-        unk_F64E20.z = unk.z;
+        motion.UnkF64E20.x = unk.x;
+        motion.UnkF64E20.y = unk.y;
+        motion.UnkF64E20.z = unk.z;
 
         sprite_direction = moveInfo->direction;
         bank_rotation = moveInfo->bank_rotation;
@@ -359,16 +358,16 @@ bool Vehicle::CableLiftUpdateTrackMotionBackwards()
  *
  *  rct2: 0x006DEF56
  */
-int32_t Vehicle::CableLiftUpdateTrackMotion()
+int32_t Vehicle::CableLiftUpdateTrackMotion(VehicleMotionContext& motion)
 {
-    _vehicleF64E2C = 0;
-    gCurrentVehicle = this;
-    _vehicleMotionTrackFlags = 0;
-    _vehicleStationIndex = STATION_INDEX_NULL;
+    motion.F64E2C = 0;
+    motion.CurrentVehicle = this;
+    motion.MotionTrackFlags = 0;
+    motion.CurrentStation = STATION_INDEX_NULL;
 
     velocity += acceleration;
-    _vehicleVelocityF64E08 = velocity;
-    _vehicleVelocityF64E0C = (velocity / 1024) * 42;
+    motion.VelocityF64E08 = velocity;
+    motion.VelocityF64E0C = (velocity / 1024) * 42;
 
     Vehicle* frontVehicle = this;
     if (velocity < 0)
@@ -376,61 +375,61 @@ int32_t Vehicle::CableLiftUpdateTrackMotion()
         frontVehicle = TrainTail();
     }
 
-    _vehicleFrontVehicle = frontVehicle;
+    motion.FrontVehicle = frontVehicle;
 
     for (Vehicle* vehicle = frontVehicle;;)
     {
         vehicle->acceleration = dword_9A2970[vehicle->vehicle_sprite_type];
-        _vehicleUnkF64E10 = 1;
-        vehicle->remaining_distance += _vehicleVelocityF64E0C;
+        motion.UnkF64E10 = 1;
+        vehicle->remaining_distance += motion.VelocityF64E0C;
 
         if (vehicle->remaining_distance < 0 || vehicle->remaining_distance >= 13962)
         {
-            unk_F64E20.x = vehicle->x;
-            unk_F64E20.y = vehicle->y;
-            unk_F64E20.z = vehicle->z;
+            motion.UnkF64E20.x = vehicle->x;
+            motion.UnkF64E20.y = vehicle->y;
+            motion.UnkF64E20.z = vehicle->z;
             vehicle->Invalidate();
 
             while (true)
             {
                 if (vehicle->remaining_distance < 0)
                 {
-                    if (vehicle->CableLiftUpdateTrackMotionBackwards())
+                    if (vehicle->CableLiftUpdateTrackMotionBackwards(motion))
                     {
                         break;
                     }
                     else
                     {
-                        _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
-                        _vehicleVelocityF64E0C -= vehicle->remaining_distance - 13962;
+                        motion.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
+                        motion.VelocityF64E0C -= vehicle->remaining_distance - 13962;
                         vehicle->remaining_distance = 13962;
                         vehicle->acceleration += dword_9A2970[vehicle->vehicle_sprite_type];
-                        _vehicleUnkF64E10++;
+                        motion.UnkF64E10++;
                         continue;
                     }
                 }
                 else
                 {
-                    if (vehicle->CableLiftUpdateTrackMotionForwards())
+                    if (vehicle->CableLiftUpdateTrackMotionForwards(motion))
                     {
                         break;
                     }
                     else
                     {
-                        _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
-                        _vehicleVelocityF64E0C -= vehicle->remaining_distance + 1;
+                        motion.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
+                        motion.VelocityF64E0C -= vehicle->remaining_distance + 1;
                         vehicle->remaining_distance = -1;
                         vehicle->acceleration += dword_9A2970[vehicle->vehicle_sprite_type];
-                        _vehicleUnkF64E10++;
+                        motion.UnkF64E10++;
                     }
                 }
             }
-            vehicle->MoveTo(unk_F64E20);
+            vehicle->MoveTo(motion.UnkF64E20);
 
             vehicle->Invalidate();
         }
-        vehicle->acceleration /= _vehicleUnkF64E10;
-        if (_vehicleVelocityF64E08 >= 0)
+        vehicle->acceleration /= motion.UnkF64E10;
+        if (motion.VelocityF64E08 >= 0)
         {
             if (vehicle->next_vehicle_on_train == SPRITE_INDEX_NULL)
                 break;
@@ -472,5 +471,5 @@ int32_t Vehicle::CableLiftUpdateTrackMotion()
     newAcceleration -= edx / massTotal;
 
     acceleration = newAcceleration;
-    return _vehicleMotionTrackFlags;
+    return motion.MotionTrackFlags;
 }
@@ -4745,7 +4745,8 @@ static bool ride_create_vehicles(Ride* ride, CoordsXYE* element, int32_t isApply
 
                 if (!(vehicleEntry->flags & VEHICLE_ENTRY_FLAG_DODGEM_CAR_PLACEMENT))
                 {
-                    vehicle->UpdateTrackMotion(nullptr);
+                    VehicleMotionContext motion;
+                    vehicle->UpdateTrackMotion(motion, nullptr);
                 }
 
                 vehicle_unset_update_flag_b1(vehicle);
@@ -4771,14 +4772,15 @@ void loc_6DDF9C(Ride* ride, TileElement* tileElement)
             continue;
 
         train = GET_VEHICLE(vehicleSpriteIdx);
+        VehicleMotionContext motion;
         if (i == 0)
         {
-            train->UpdateTrackMotion(nullptr);
+            train->UpdateTrackMotion(motion, nullptr);
             vehicle_unset_update_flag_b1(train);
             continue;
         }
 
-        train->UpdateTrackMotion(nullptr);
+        train->UpdateTrackMotion(motion, nullptr);
 
         do
         {
@@ -4798,7 +4800,7 @@ void loc_6DDF9C(Ride* ride, TileElement* tileElement)
                 }
                 car = GET_VEHICLE(spriteIndex);
             }
-        } while (!(train->UpdateTrackMotion(nullptr) & VEHICLE_UPDATE_MOTION_TRACK_FLAG_10));
+        } while (!(train->UpdateTrackMotion(motion, nullptr) & VEHICLE_UPDATE_MOTION_TRACK_FLAG_10));
 
         tileElement->AsTrack()->SetBlockBrakeClosed(true);
         car = train;
@@ -4996,7 +4998,8 @@ static bool ride_create_cable_lift(ride_id_t rideIndex, bool isApplying)
     tail->next_vehicle_on_ride = head->sprite_index;
 
     ride->lifecycle_flags |= RIDE_LIFECYCLE_CABLE_LIFT;
-    head->CableLiftUpdateTrackMotion();
+    VehicleMotionContext motion;
+    head->CableLiftUpdateTrackMotion(motion);
     return true;
 }
 
@@ -157,6 +157,8 @@ struct RideStation
     uint8_t QueueTime;
     uint16_t QueueLength;
     uint16_t LastPeepInQueue;
+    // Start position whose station light was last set to red, not saved. Lets closed rides skip the tile search.
+    CoordsXYZ RedLightStart = { LOCATION_NULL, LOCATION_NULL, 0 };
 
     static constexpr uint8_t NO_TRAIN = std::numeric_limits<uint8_t>::max();
 
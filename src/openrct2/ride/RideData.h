@@ -27,7 +27,7 @@
 #include "Track.h"
 #include "TrackPaint.h"
 
-using ride_ratings_calculation = void (*)(Ride* ride);
+using ride_ratings_calculation = void (*)(Ride* ride, RideRatingCalculationData& calcData);
 struct RideComponentName
 {
     rct_string_id singular;
@@ -12,6 +12,7 @@
 #include "../Cheats.h"
 #include "../Context.h"
 #include "../OpenRCT2.h"
+#include "../core/JobPool.hpp"
 #include "../interface/Window.h"
 #include "../localisation/Date.h"
 #include "../scripting/ScriptEngine.h"
@@ -29,16 +30,6 @@
 using namespace OpenRCT2;
 using namespace OpenRCT2::Scripting;
 
-enum
-{
-    RIDE_RATINGS_STATE_FIND_NEXT_RIDE,
-    RIDE_RATINGS_STATE_INITIALISE,
-    RIDE_RATINGS_STATE_2,
-    RIDE_RATINGS_STATE_CALCULATE,
-    RIDE_RATINGS_STATE_4,
-    RIDE_RATINGS_STATE_5
-};
-
 enum
 {
     PROXIMITY_WATER_OVER,                   // 0x0138B596
@@ -78,35 +69,91 @@ struct ShelteredEights
 
 RideRatingCalculationData gRideRatingsCalcData;
 
-static void ride_ratings_update_state();
-static void ride_ratings_update_state_0();
-static void ride_ratings_update_state_1();
-static void ride_ratings_update_state_2();
-static void ride_ratings_update_state_3();
-static void ride_ratings_update_state_4();
-static void ride_ratings_update_state_5();
-static void ride_ratings_begin_proximity_loop();
-static void ride_ratings_calculate(Ride* ride);
+static void ride_ratings_update_state(RideRatingCalculationData& calcData);
+static void ride_ratings_update_state_0(RideRatingCalculationData& calcData);
+static void ride_ratings_update_state_1(RideRatingCalculationData& calcData);
+static void ride_ratings_update_state_2(RideRatingCalculationData& calcData);
+static void ride_ratings_update_state_3(RideRatingCalculationData& calcData);
+static void ride_ratings_update_state_4(RideRatingCalculationData& calcData);
+static void ride_ratings_update_state_5(RideRatingCalculationData& calcData);
+static void ride_ratings_begin_proximity_loop(RideRatingCalculationData& calcData);
+static void ride_ratings_calculate(Ride* ride, RideRatingCalculationData& calcData);
+static void ride_ratings_finish(Ride* ride);
 static void ride_ratings_calculate_value(Ride* ride);
-static void ride_ratings_score_close_proximity(TileElement* inputTileElement);
+static void ride_ratings_score_close_proximity(RideRatingCalculationData& calcData, TileElement* inputTileElement);
 
 static void ride_ratings_add(RatingTuple* rating, int32_t excitement, int32_t intensity, int32_t nausea);
 
 /**
- * This is a small hack function to keep calling the ride rating processor until
- * the given ride's ratings have been calculated. What ever is currently being
- * processed will be overwritten.
- * Only purpose of this function currently is for testing.
+ * Walks the track of the given ride and runs its ratings calculation function without touching the legacy state machine.
+ * Only reads the map and writes to the given ride, so it can run for several rides at once. Returns false if the ride
+ * could not be rated, in which case the legacy state machine would have skipped it too.
+ */
+static bool ride_ratings_calculate_ride(Ride& ride)
+{
+    RideRatingCalculationData calcData{};
+    calcData.current_ride = ride.id;
+    calcData.state = RIDE_RATINGS_STATE_INITIALISE;
+    while (calcData.state != RIDE_RATINGS_STATE_FIND_NEXT_RIDE && calcData.state != RIDE_RATINGS_STATE_CALCULATE)
+    {
+        ride_ratings_update_state(calcData);
+    }
+    if (calcData.state != RIDE_RATINGS_STATE_CALCULATE)
+        return false;
+
+    ride_ratings_calculate(&ride, calcData);
+    return true;
+}
+
+/**
+ * Calculates the given ride's ratings to completion. The legacy state machine is left untouched, so whatever it is
+ * currently processing carries on next tick.
  */
 void ride_ratings_update_ride(const Ride& ride)
 {
     if (ride.status != RIDE_STATUS_CLOSED)
     {
-        gRideRatingsCalcData.current_ride = ride.id;
-        gRideRatingsCalcData.state = RIDE_RATINGS_STATE_INITIALISE;
-        while (gRideRatingsCalcData.state != RIDE_RATINGS_STATE_FIND_NEXT_RIDE)
+        ride_ratings_update_rides({ ride.id });
+    }
+}
+
+/**
+ * Calculates the ratings of all the given rides to completion. The track walk and the ride type calculation for each ride
+ * run on a job pool, the rest of the calculation then runs here in the order of the given rides.
+ */
+void ride_ratings_update_rides(const std::vector<ride_id_t>& rideIds)
+{
+    std::vector<Ride*> rides;
+    for (auto rideId : rideIds)
+    {
+        auto ride = get_ride(rideId);
+        if (ride != nullptr && ride->status != RIDE_STATUS_CLOSED)
         {
-            ride_ratings_update_state();
+            rides.push_back(ride);
+        }
+    }
+
+    // std::vector<bool> packs its elements so it is not safe to write to from several threads.
+    std::vector<uint8_t> calculated(rides.size());
+    if (rides.size() == 1)
+    {
+        calculated[0] = ride_ratings_calculate_ride(*rides[0]);
+    }
+    else if (!rides.empty())
+    {
+        JobPool jobPool;
+        for (size_t i = 0; i < rides.size(); i++)
+        {
+            jobPool.AddTask([&rides, &calculated, i]() { calculated[i] = ride_ratings_calculate_ride(*rides[i]); });
+        }
+        jobPool.Join();
+    }
+
+    for (size_t i = 0; i < rides.size(); i++)
+    {
+        if (calculated[i])
+        {
+            ride_ratings_finish(rides[i]);
         }
     }
 }
@@ -120,30 +167,30 @@ void ride_ratings_update_all()
     if (gScreenFlags & SCREEN_FLAGS_SCENARIO_EDITOR)
         return;
 
-    ride_ratings_update_state();
+    ride_ratings_update_state(gRideRatingsCalcData);
 }
 
-static void ride_ratings_update_state()
+static void ride_ratings_update_state(RideRatingCalculationData& calcData)
 {
-    switch (gRideRatingsCalcData.state)
+    switch (calcData.state)
     {
         case RIDE_RATINGS_STATE_FIND_NEXT_RIDE:
-            ride_ratings_update_state_0();
+            ride_ratings_update_state_0(calcData);
             break;
         case RIDE_RATINGS_STATE_INITIALISE:
-            ride_ratings_update_state_1();
+            ride_ratings_update_state_1(calcData);
             break;
         case RIDE_RATINGS_STATE_2:
-            ride_ratings_update_state_2();
+            ride_ratings_update_state_2(calcData);
             break;
         case RIDE_RATINGS_STATE_CALCULATE:
-            ride_ratings_update_state_3();
+            ride_ratings_update_state_3(calcData);
             break;
         case RIDE_RATINGS_STATE_4:
-            ride_ratings_update_state_4();
+            ride_ratings_update_state_4(calcData);
             break;
         case RIDE_RATINGS_STATE_5:
-            ride_ratings_update_state_5();
+            ride_ratings_update_state_5(calcData);
             break;
     }
 }
@@ -152,9 +199,9 @@ static void ride_ratings_update_state()
  *
  *  rct2: 0x006B5A5C
  */
-static void ride_ratings_update_state_0()
+static void ride_ratings_update_state_0(RideRatingCalculationData& calcData)
 {
-    int32_t currentRide = gRideRatingsCalcData.current_ride;
+    int32_t currentRide = calcData.current_ride;
 
     currentRide++;
     if (currentRide == RIDE_ID_NULL)
@@ -165,51 +212,51 @@ static void ride_ratings_update_state_0()
     auto ride = get_ride(currentRide);
     if (ride != nullptr && ride->status != RIDE_STATUS_CLOSED)
     {
-        gRideRatingsCalcData.state = RIDE_RATINGS_STATE_INITIALISE;
+        calcData.state = RIDE_RATINGS_STATE_INITIALISE;
     }
-    gRideRatingsCalcData.current_ride = currentRide;
+    calcData.current_ride = currentRide;
 }
 
 /**
  *
  *  rct2: 0x006B5A94
  */
-static void ride_ratings_update_state_1()
+static void ride_ratings_update_state_1(RideRatingCalculationData& calcData)
 {
-    gRideRatingsCalcData.proximity_total = 0;
+    calcData.proximity_total = 0;
     for (int32_t i = 0; i < PROXIMITY_COUNT; i++)
     {
-        gRideRatingsCalcData.proximity_scores[i] = 0;
+        calcData.proximity_scores[i] = 0;
     }
-    gRideRatingsCalcData.num_brakes = 0;
-    gRideRatingsCalcData.num_reversers = 0;
-    gRideRatingsCalcData.state = RIDE_RATINGS_STATE_2;
-    gRideRatingsCalcData.station_flags = 0;
-    ride_ratings_begin_proximity_loop();
+    calcData.num_brakes = 0;
+    calcData.num_reversers = 0;
+    calcData.state = RIDE_RATINGS_STATE_2;
+    calcData.station_flags = 0;
+    ride_ratings_begin_proximity_loop(calcData);
 }
 
 /**
  *
  *  rct2: 0x006B5C66
  */
-static void ride_ratings_update_state_2()
+static void ride_ratings_update_state_2(RideRatingCalculationData& calcData)
 {
-    const ride_id_t rideIndex = gRideRatingsCalcData.current_ride;
+    const ride_id_t rideIndex = calcData.current_ride;
     auto ride = get_ride(rideIndex);
     if (ride == nullptr || ride->status == RIDE_STATUS_CLOSED)
     {
-        gRideRatingsCalcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+        calcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
         return;
     }
 
-    auto loc = CoordsXYZ{ gRideRatingsCalcData.proximity_x, gRideRatingsCalcData.proximity_y,
-                          gRideRatingsCalcData.proximity_z };
-    int32_t trackType = gRideRatingsCalcData.proximity_track_type;
+    auto loc = CoordsXYZ{ calcData.proximity_x, calcData.proximity_y,
+                          calcData.proximity_z };
+    int32_t trackType = calcData.proximity_track_type;
 
     TileElement* tileElement = map_get_first_element_at(loc);
     if (tileElement == nullptr)
     {
-        gRideRatingsCalcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+        calcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
         return;
     }
     do
@@ -233,97 +280,95 @@ static void ride_ratings_update_state_2()
             if (trackType == TRACK_ELEM_END_STATION)
             {
                 int32_t entranceIndex = tileElement->AsTrack()->GetStationIndex();
-                gRideRatingsCalcData.station_flags &= ~RIDE_RATING_STATION_FLAG_NO_ENTRANCE;
+                calcData.station_flags &= ~RIDE_RATING_STATION_FLAG_NO_ENTRANCE;
                 if (ride_get_entrance_location(ride, entranceIndex).isNull())
                 {
-                    gRideRatingsCalcData.station_flags |= RIDE_RATING_STATION_FLAG_NO_ENTRANCE;
+                    calcData.station_flags |= RIDE_RATING_STATION_FLAG_NO_ENTRANCE;
                 }
             }
 
-            ride_ratings_score_close_proximity(tileElement);
+            ride_ratings_score_close_proximity(calcData, tileElement);
 
             CoordsXYE trackElement = {
-                /* .x = */ gRideRatingsCalcData.proximity_x,
-                /* .y = */ gRideRatingsCalcData.proximity_y,
+                /* .x = */ calcData.proximity_x,
+                /* .y = */ calcData.proximity_y,
                 /* .element = */ tileElement,
             };
             CoordsXYE nextTrackElement;
             if (!track_block_get_next(&trackElement, &nextTrackElement, nullptr, nullptr))
             {
-                gRideRatingsCalcData.state = RIDE_RATINGS_STATE_4;
+                calcData.state = RIDE_RATINGS_STATE_4;
                 return;
             }
 
             loc = { nextTrackElement, nextTrackElement.element->GetBaseZ() };
             tileElement = nextTrackElement.element;
-            if (loc.x == gRideRatingsCalcData.proximity_start_x && loc.y == gRideRatingsCalcData.proximity_start_y
-                && loc.z == gRideRatingsCalcData.proximity_start_z)
+            if (loc.x == calcData.proximity_start_x && loc.y == calcData.proximity_start_y
+                && loc.z == calcData.proximity_start_z)
             {
-                gRideRatingsCalcData.state = RIDE_RATINGS_STATE_CALCULATE;
+                calcData.state = RIDE_RATINGS_STATE_CALCULATE;
                 return;
             }
-            gRideRatingsCalcData.proximity_x = loc.x;
-            gRideRatingsCalcData.proximity_y = loc.y;
-            gRideRatingsCalcData.proximity_z = loc.z;
-            gRideRatingsCalcData.proximity_track_type = tileElement->AsTrack()->GetTrackType();
+            calcData.proximity_x = loc.x;
+            calcData.proximity_y = loc.y;
+            calcData.proximity_z = loc.z;
+            calcData.proximity_track_type = tileElement->AsTrack()->GetTrackType();
             return;
         }
     } while (!(tileElement++)->IsLastForTile());
 
-    gRideRatingsCalcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+    calcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
 }
 
 /**
  *
  *  rct2: 0x006B5E4D
  */
-static void ride_ratings_update_state_3()
+static void ride_ratings_update_state_3(RideRatingCalculationData& calcData)
 {
-    auto ride = get_ride(gRideRatingsCalcData.current_ride);
+    auto ride = get_ride(calcData.current_ride);
     if (ride == nullptr || ride->status == RIDE_STATUS_CLOSED)
     {
-        gRideRatingsCalcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+        calcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
         return;
     }
 
-    ride_ratings_calculate(ride);
-    ride_ratings_calculate_value(ride);
-
-    window_invalidate_by_number(WC_RIDE, gRideRatingsCalcData.current_ride);
-    gRideRatingsCalcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+    ride_ratings_calculate(ride, calcData);
+    ride_ratings_finish(ride);
+    calcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
 }
 
 /**
  *
  *  rct2: 0x006B5BAB
  */
-static void ride_ratings_update_state_4()
+static void ride_ratings_update_state_4(RideRatingCalculationData& calcData)
 {
-    gRideRatingsCalcData.state = RIDE_RATINGS_STATE_5;
-    ride_ratings_begin_proximity_loop();
+    calcData.state = RIDE_RATINGS_STATE_5;
+    ride_ratings_begin_proximity_loop(calcData);
 }
 
 /**
  *
  *  rct2: 0x006B5D72
  */
-static void ride_ratings_update_state_5()
+static void ride_ratings_update_state_5(RideRatingCalculationData& calcData)
 {
-    auto ride = get_ride(gRideRatingsCalcData.current_ride);
+    auto ride = get_ride(calcData.current_ride);
     if (ride == nullptr || ride->status == RIDE_STATUS_CLOSED)
     {
-        gRideRatingsCalcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+        calcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
         return;
     }
 
-    auto loc = CoordsXYZ{ gRideRatingsCalcData.proximity_x, gRideRatingsCalcData.proximity_y,
-                          gRideRatingsCalcData.proximity_z };
-    int32_t trackType = gRideRatingsCalcData.proximity_track_type;
+    auto loc = CoordsXYZ{ calcData.proximity_x, calcData.proximity_y,
+                          calcData.proximity_z };
+    int32_t trackType = calcData.proximity_track_type;
 
     TileElement* tileElement = map_get_first_element_at(loc);
     if (tileElement == nullptr)
     {
-        gRideRatingsCalcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+        calcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
         return;
     }
     do
@@ -343,53 +388,53 @@ static void ride_ratings_update_state_5()
 
         if (trackType == 255 || trackType == tileElement->AsTrack()->GetTrackType())
         {
-            ride_ratings_score_close_proximity(tileElement);
+            ride_ratings_score_close_proximity(calcData, tileElement);
 
-            loc.x = gRideRatingsCalcData.proximity_x;
-            loc.y = gRideRatingsCalcData.proximity_y;
+            loc.x = calcData.proximity_x;
+            loc.y = calcData.proximity_y;
             track_begin_end trackBeginEnd;
             if (!track_block_get_previous({ loc, tileElement }, &trackBeginEnd))
             {
-                gRideRatingsCalcData.state = RIDE_RATINGS_STATE_CALCULATE;
+                calcData.state = RIDE_RATINGS_STATE_CALCULATE;
                 return;
             }
 
             loc.x = trackBeginEnd.begin_x;
             loc.y = trackBeginEnd.begin_y;
             loc.z = trackBeginEnd.begin_z;
-            if (loc.x == gRideRatingsCalcData.proximity_start_x && loc.y == gRideRatingsCalcData.proximity_start_y
-                && loc.z == gRideRatingsCalcData.proximity_start_z)
+            if (loc.x == calcData.proximity_start_x && loc.y == calcData.proximity_start_y
+                && loc.z == calcData.proximity_start_z)
             {
-                gRideRatingsCalcData.state = RIDE_RATINGS_STATE_CALCULATE;
+                calcData.state = RIDE_RATINGS_STATE_CALCULATE;
                 return;
             }
-            gRideRatingsCalcData.proximity_x = loc.x;
-            gRideRatingsCalcData.proximity_y = loc.y;
-            gRideRatingsCalcData.proximity_z = loc.z;
-            gRideRatingsCalcData.proximity_track_type = trackBeginEnd.begin_element->AsTrack()->GetTrackType();
+            calcData.proximity_x = loc.x;
+            calcData.proximity_y = loc.y;
+            calcData.proximity_z = loc.z;
+            calcData.proximity_track_type = trackBeginEnd.begin_element->AsTrack()->GetTrackType();
             return;
         }
     } while (!(tileElement++)->IsLastForTile());
 
-    gRideRatingsCalcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+    calcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
 }
 
 /**
  *
  *  rct2: 0x006B5BB2
  */
-static void ride_ratings_begin_proximity_loop()
+static void ride_ratings_begin_proximity_loop(RideRatingCalculationData& calcData)
 {
-    auto ride = get_ride(gRideRatingsCalcData.current_ride);
+    auto ride = get_ride(calcData.current_ride);
     if (ride == nullptr || ride->status == RIDE_STATUS_CLOSED)
     {
-        gRideRatingsCalcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+        calcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
         return;
     }
 
     if (ride->type == RIDE_TYPE_MAZE)
     {
-        gRideRatingsCalcData.state = RIDE_RATINGS_STATE_CALCULATE;
+        calcData.state = RIDE_RATINGS_STATE_CALCULATE;
         return;
     }
 
@@ -397,41 +442,42 @@ static void ride_ratings_begin_proximity_loop()
     {
         if (!ride->stations[i].Start.isNull())
         {
-            gRideRatingsCalcData.station_flags &= ~RIDE_RATING_STATION_FLAG_NO_ENTRANCE;
+            calcData.station_flags &= ~RIDE_RATING_STATION_FLAG_NO_ENTRANCE;
             if (ride_get_entrance_location(ride, i).isNull())
             {
-                gRideRatingsCalcData.station_flags |= RIDE_RATING_STATION_FLAG_NO_ENTRANCE;
+                calcData.station_flags |= RIDE_RATING_STATION_FLAG_NO_ENTRANCE;
             }
 
             auto location = ride->stations[i].GetStart();
 
-            gRideRatingsCalcData.proximity_x = location.x;
-            gRideRatingsCalcData.proximity_y = location.y;
-            gRideRatingsCalcData.proximity_z = location.z;
-            gRideRatingsCalcData.proximity_track_type = 255;
-            gRideRatingsCalcData.proximity_start_x = location.x;
-            gRideRatingsCalcData.proximity_start_y = location.y;
-            gRideRatingsCalcData.proximity_start_z = location.z;
+            calcData.proximity_x = location.x;
+            calcData.proximity_y = location.y;
+            calcData.proximity_z = location.z;
+            calcData.proximity_track_type = 255;
+            calcData.proximity_start_x = location.x;
+            calcData.proximity_start_y = location.y;
+            calcData.proximity_start_z = location.z;
             return;
         }
     }
 
-    gRideRatingsCalcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+    calcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
 }
 
-static void proximity_score_increment(int32_t type)
+static void proximity_score_increment(RideRatingCalculationData& calcData, int32_t type)
 {
-    gRideRatingsCalcData.proximity_scores[type]++;
+    calcData.proximity_scores[type]++;
 }
 
 /**
  *
  *  rct2: 0x006B6207
  */
-static void ride_ratings_score_close_proximity_in_direction(TileElement* inputTileElement, int32_t direction)
+static void ride_ratings_score_close_proximity_in_direction(
+    RideRatingCalculationData& calcData, TileElement* inputTileElement, int32_t direction)
 {
-    auto scorePos = CoordsXY{ gRideRatingsCalcData.proximity_x + CoordsDirectionDelta[direction].x,
-                              gRideRatingsCalcData.proximity_y + CoordsDirectionDelta[direction].y };
+    auto scorePos = CoordsXY{ calcData.proximity_x + CoordsDirectionDelta[direction].x,
+                              calcData.proximity_y + CoordsDirectionDelta[direction].y };
     if (!map_is_location_valid(scorePos))
         return;
 
@@ -446,18 +492,18 @@ static void ride_ratings_score_close_proximity_in_direction(TileElement* inputTi
         switch (tileElement->GetType())
         {
             case TILE_ELEMENT_TYPE_SURFACE:
-                if (gRideRatingsCalcData.proximity_base_height <= inputTileElement->base_height)
+                if (calcData.proximity_base_height <= inputTileElement->base_height)
                 {
                     if (inputTileElement->clearance_height <= tileElement->base_height)
                     {
-                        proximity_score_increment(PROXIMITY_SURFACE_SIDE_CLOSE);
+                        proximity_score_increment(calcData, PROXIMITY_SURFACE_SIDE_CLOSE);
                     }
                 }
                 break;
             case TILE_ELEMENT_TYPE_PATH:
                 if (abs(inputTileElement->GetBaseZ() - tileElement->GetBaseZ()) <= 2 * COORDS_Z_STEP)
                 {
-                    proximity_score_increment(PROXIMITY_PATH_SIDE_CLOSE);
+                    proximity_score_increment(calcData, PROXIMITY_PATH_SIDE_CLOSE);
                 }
                 break;
             case TILE_ELEMENT_TYPE_TRACK:
@@ -465,7 +511,7 @@ static void ride_ratings_score_close_proximity_in_direction(TileElement* inputTi
                 {
                     if (abs(inputTileElement->GetBaseZ() - tileElement->GetBaseZ()) <= 2 * COORDS_Z_STEP)
                     {
-                        proximity_score_increment(PROXIMITY_FOREIGN_TRACK_SIDE_CLOSE);
+                        proximity_score_increment(calcData, PROXIMITY_FOREIGN_TRACK_SIDE_CLOSE);
                     }
                 }
                 break;
@@ -475,11 +521,11 @@ static void ride_ratings_score_close_proximity_in_direction(TileElement* inputTi
                 {
                     if (inputTileElement->GetBaseZ() > tileElement->GetClearanceZ())
                     {
-                        proximity_score_increment(PROXIMITY_SCENERY_SIDE_ABOVE);
+                        proximity_score_increment(calcData, PROXIMITY_SCENERY_SIDE_ABOVE);
                     }
                     else
                     {
-                        proximity_score_increment(PROXIMITY_SCENERY_SIDE_BELOW);
+                        proximity_score_increment(calcData, PROXIMITY_SCENERY_SIDE_BELOW);
                     }
                 }
                 break;
@@ -487,7 +533,8 @@ static void ride_ratings_score_close_proximity_in_direction(TileElement* inputTi
     } while (!(tileElement++)->IsLastForTile());
 }
 
-static void ride_ratings_score_close_proximity_loops_helper(TileElement* inputTileElement, int32_t x, int32_t y)
+static void ride_ratings_score_close_proximity_loops_helper(
+    RideRatingCalculationData& calcData, TileElement* inputTileElement, int32_t x, int32_t y)
 {
     TileElement* tileElement = map_get_first_element_at({ x, y });
     if (tileElement == nullptr)
@@ -505,7 +552,7 @@ static void ride_ratings_score_close_proximity_loops_helper(TileElement* inputTi
                     - static_cast<int32_t>(inputTileElement->base_height);
                 if (zDiff >= 0 && zDiff <= 16)
                 {
-                    proximity_score_increment(PROXIMITY_PATH_TROUGH_VERTICAL_LOOP);
+                    proximity_score_increment(calcData, PROXIMITY_PATH_TROUGH_VERTICAL_LOOP);
                 }
             }
             break;
@@ -519,11 +566,11 @@ static void ride_ratings_score_close_proximity_loops_helper(TileElement* inputTi
                         - static_cast<int32_t>(inputTileElement->base_height);
                     if (zDiff >= 0 && zDiff <= 16)
                     {
-                        proximity_score_increment(PROXIMITY_TRACK_THROUGH_VERTICAL_LOOP);
+                        proximity_score_increment(calcData, PROXIMITY_TRACK_THROUGH_VERTICAL_LOOP);
                         if (tileElement->AsTrack()->GetTrackType() == TRACK_ELEM_LEFT_VERTICAL_LOOP
                             || tileElement->AsTrack()->GetTrackType() == TRACK_ELEM_RIGHT_VERTICAL_LOOP)
                         {
-                            proximity_score_increment(PROXIMITY_INTERSECTING_VERTICAL_LOOP);
+                            proximity_score_increment(calcData, PROXIMITY_INTERSECTING_VERTICAL_LOOP);
                         }
                     }
                 }
@@ -537,19 +584,19 @@ static void ride_ratings_score_close_proximity_loops_helper(TileElement* inputTi
  *
  *  rct2: 0x006B62DA
  */
-static void ride_ratings_score_close_proximity_loops(TileElement* inputTileElement)
+static void ride_ratings_score_close_proximity_loops(RideRatingCalculationData& calcData, TileElement* inputTileElement)
 {
     int32_t trackType = inputTileElement->AsTrack()->GetTrackType();
     if (trackType == TRACK_ELEM_LEFT_VERTICAL_LOOP || trackType == TRACK_ELEM_RIGHT_VERTICAL_LOOP)
     {
-        int32_t x = gRideRatingsCalcData.proximity_x;
-        int32_t y = gRideRatingsCalcData.proximity_y;
-        ride_ratings_score_close_proximity_loops_helper(inputTileElement, x, y);
+        int32_t x = calcData.proximity_x;
+        int32_t y = calcData.proximity_y;
+        ride_ratings_score_close_proximity_loops_helper(calcData, inputTileElement, x, y);
 
         int32_t direction = inputTileElement->GetDirection();
-        x = gRideRatingsCalcData.proximity_x + CoordsDirectionDelta[direction].x;
-        y = gRideRatingsCalcData.proximity_y + CoordsDirectionDelta[direction].y;
-        ride_ratings_score_close_proximity_loops_helper(inputTileElement, x, y);
+        x = calcData.proximity_x + CoordsDirectionDelta[direction].x;
+        y = calcData.proximity_y + CoordsDirectionDelta[direction].y;
+        ride_ratings_score_close_proximity_loops_helper(calcData, inputTileElement, x, y);
     }
 }
 
@@ -557,16 +604,16 @@ static void ride_ratings_score_close_proximity_loops(TileElement* inputTileEleme
  *
  *  rct2: 0x006B5F9D
  */
-static void ride_ratings_score_close_proximity(TileElement* inputTileElement)
+static void ride_ratings_score_close_proximity(RideRatingCalculationData& calcData, TileElement* inputTileElement)
 {
-    if (gRideRatingsCalcData.station_flags & RIDE_RATING_STATION_FLAG_NO_ENTRANCE)
+    if (calcData.station_flags & RIDE_RATING_STATION_FLAG_NO_ENTRANCE)
     {
         return;
     }
 
-    gRideRatingsCalcData.proximity_total++;
-    int32_t x = gRideRatingsCalcData.proximity_x;
-    int32_t y = gRideRatingsCalcData.proximity_y;
+    calcData.proximity_total++;
+    int32_t x = calcData.proximity_x;
+    int32_t y = calcData.proximity_y;
     TileElement* tileElement = map_get_first_element_at({ x, y });
     if (tileElement == nullptr)
         return;
@@ -579,31 +626,31 @@ static void ride_ratings_score_close_proximity(TileElement* inputTileElement)
         switch (tileElement->GetType())
         {
             case TILE_ELEMENT_TYPE_SURFACE:
-                gRideRatingsCalcData.proximity_base_height = tileElement->base_height;
-                if (tileElement->GetBaseZ() == gRideRatingsCalcData.proximity_z)
+                calcData.proximity_base_height = tileElement->base_height;
+                if (tileElement->GetBaseZ() == calcData.proximity_z)
                 {
-                    proximity_score_increment(PROXIMITY_SURFACE_TOUCH);
+                    proximity_score_increment(calcData, PROXIMITY_SURFACE_TOUCH);
                 }
                 waterHeight = tileElement->AsSurface()->GetWaterHeight();
                 if (waterHeight != 0)
                 {
                     auto z = waterHeight;
-                    if (z <= gRideRatingsCalcData.proximity_z)
+                    if (z <= calcData.proximity_z)
                     {
-                        proximity_score_increment(PROXIMITY_WATER_OVER);
-                        if (z == gRideRatingsCalcData.proximity_z)
+                        proximity_score_increment(calcData, PROXIMITY_WATER_OVER);
+                        if (z == calcData.proximity_z)
                         {
-                            proximity_score_increment(PROXIMITY_WATER_TOUCH);
+                            proximity_score_increment(calcData, PROXIMITY_WATER_TOUCH);
                         }
                         z += 16;
-                        if (z == gRideRatingsCalcData.proximity_z)
+                        if (z == calcData.proximity_z)
                         {
-                            proximity_score_increment(PROXIMITY_WATER_LOW);
+                            proximity_score_increment(calcData, PROXIMITY_WATER_LOW);
                         }
                         z += 112;
-                        if (z <= gRideRatingsCalcData.proximity_z)
+                        if (z <= calcData.proximity_z)
                         {
-                            proximity_score_increment(PROXIMITY_WATER_HIGH);
+                            proximity_score_increment(calcData, PROXIMITY_WATER_HIGH);
                         }
                     }
                 }
@@ -614,11 +661,11 @@ static void ride_ratings_score_close_proximity(TileElement* inputTileElement)
                 {
                     if (tileElement->GetClearanceZ() == inputTileElement->GetBaseZ())
                     {
-                        proximity_score_increment(PROXIMITY_PATH_TOUCH_ABOVE);
+                        proximity_score_increment(calcData, PROXIMITY_PATH_TOUCH_ABOVE);
                     }
                     if (tileElement->GetBaseZ() == inputTileElement->GetClearanceZ())
                     {
-                        proximity_score_increment(PROXIMITY_PATH_TOUCH_UNDER);
+                        proximity_score_increment(calcData, PROXIMITY_PATH_TOUCH_UNDER);
                     }
                 }
                 else
@@ -626,15 +673,15 @@ static void ride_ratings_score_close_proximity(TileElement* inputTileElement)
                     // Bonus for path in first object entry
                     if (tileElement->GetClearanceZ() <= inputTileElement->GetBaseZ())
                     {
-                        proximity_score_increment(PROXIMITY_PATH_ZERO_OVER);
+                        proximity_score_increment(calcData, PROXIMITY_PATH_ZERO_OVER);
                     }
                     if (tileElement->GetClearanceZ() == inputTileElement->GetBaseZ())
                     {
-                        proximity_score_increment(PROXIMITY_PATH_ZERO_TOUCH_ABOVE);
+                        proximity_score_increment(calcData, PROXIMITY_PATH_ZERO_TOUCH_ABOVE);
                     }
                     if (tileElement->GetBaseZ() == inputTileElement->GetClearanceZ())
                     {
-                        proximity_score_increment(PROXIMITY_PATH_ZERO_TOUCH_UNDER);
+                        proximity_score_increment(calcData, PROXIMITY_PATH_ZERO_TOUCH_UNDER);
                     }
                 }
                 break;
@@ -648,33 +695,33 @@ static void ride_ratings_score_close_proximity(TileElement* inputTileElement)
                     {
                         if (tileElement->base_height - inputTileElement->clearance_height <= 10)
                         {
-                            proximity_score_increment(PROXIMITY_THROUGH_VERTICAL_LOOP);
+                            proximity_score_increment(calcData, PROXIMITY_THROUGH_VERTICAL_LOOP);
                         }
                     }
                 }
                 if (inputTileElement->AsTrack()->GetRideIndex() != tileElement->AsTrack()->GetRideIndex())
                 {
-                    proximity_score_increment(PROXIMITY_FOREIGN_TRACK_ABOVE_OR_BELOW);
+                    proximity_score_increment(calcData, PROXIMITY_FOREIGN_TRACK_ABOVE_OR_BELOW);
                     if (tileElement->GetClearanceZ() == inputTileElement->GetBaseZ())
                     {
-                        proximity_score_increment(PROXIMITY_FOREIGN_TRACK_TOUCH_ABOVE);
+                        proximity_score_increment(calcData, PROXIMITY_FOREIGN_TRACK_TOUCH_ABOVE);
                     }
                     if (tileElement->clearance_height + 2 <= inputTileElement->base_height)
                     {
                         if (tileElement->clearance_height + 10 >= inputTileElement->base_height)
                         {
-                            proximity_score_increment(PROXIMITY_FOREIGN_TRACK_CLOSE_ABOVE);
+                            proximity_score_increment(calcData, PROXIMITY_FOREIGN_TRACK_CLOSE_ABOVE);
                         }
                     }
                     if (inputTileElement->clearance_height == tileElement->base_height)
                     {
-                        proximity_score_increment(PROXIMITY_FOREIGN_TRACK_TOUCH_ABOVE);
+                        proximity_score_increment(calcData, PROXIMITY_FOREIGN_TRACK_TOUCH_ABOVE);
                     }
                     if (inputTileElement->clearance_height + 2 == tileElement->base_height)
                     {
                         if (static_cast<uint8_t>(inputTileElement->clearance_height + 10) >= tileElement->base_height)
                         {
-                            proximity_score_increment(PROXIMITY_FOREIGN_TRACK_CLOSE_ABOVE);
+                            proximity_score_increment(calcData, PROXIMITY_FOREIGN_TRACK_CLOSE_ABOVE);
                         }
                     }
                 }
@@ -683,40 +730,40 @@ static void ride_ratings_score_close_proximity(TileElement* inputTileElement)
                     bool isStation = tileElement->AsTrack()->IsStation();
                     if (tileElement->clearance_height == inputTileElement->base_height)
                     {
-                        proximity_score_increment(PROXIMITY_OWN_TRACK_TOUCH_ABOVE);
+                        proximity_score_increment(calcData, PROXIMITY_OWN_TRACK_TOUCH_ABOVE);
                         if (isStation)
                         {
-                            proximity_score_increment(PROXIMITY_OWN_STATION_TOUCH_ABOVE);
+                            proximity_score_increment(calcData, PROXIMITY_OWN_STATION_TOUCH_ABOVE);
                         }
                     }
                     if (tileElement->clearance_height + 2 <= inputTileElement->base_height)
                     {
                         if (tileElement->clearance_height + 10 >= inputTileElement->base_height)
                         {
-                            proximity_score_increment(PROXIMITY_OWN_TRACK_CLOSE_ABOVE);
+                            proximity_score_increment(calcData, PROXIMITY_OWN_TRACK_CLOSE_ABOVE);
                             if (isStation)
                             {
-                                proximity_score_increment(PROXIMITY_OWN_STATION_CLOSE_ABOVE);
+                                proximity_score_increment(calcData, PROXIMITY_OWN_STATION_CLOSE_ABOVE);
                             }
                         }
                     }
 
                     if (inputTileElement->GetClearanceZ() == tileElement->GetBaseZ())
                     {
-                        proximity_score_increment(PROXIMITY_OWN_TRACK_TOUCH_ABOVE);
+                        proximity_score_increment(calcData, PROXIMITY_OWN_TRACK_TOUCH_ABOVE);
                         if (isStation)
                         {
-                            proximity_score_increment(PROXIMITY_OWN_STATION_TOUCH_ABOVE);
+                            proximity_score_increment(calcData, PROXIMITY_OWN_STATION_TOUCH_ABOVE);
                         }
                     }
                     if (inputTileElement->clearance_height + 2 <= tileElement->base_height)
                     {
                         if (inputTileElement->clearance_height + 10 >= tileElement->base_height)
                         {
-                            proximity_score_increment(PROXIMITY_OWN_TRACK_CLOSE_ABOVE);
+                            proximity_score_increment(calcData, PROXIMITY_OWN_TRACK_CLOSE_ABOVE);
                             if (isStation)
                             {
-                                proximity_score_increment(PROXIMITY_OWN_STATION_CLOSE_ABOVE);
+                                proximity_score_increment(calcData, PROXIMITY_OWN_STATION_CLOSE_ABOVE);
                             }
                         }
                     }
@@ -727,28 +774,28 @@ static void ride_ratings_score_close_proximity(TileElement* inputTileElement)
     } while (!(tileElement++)->IsLastForTile());
 
     uint8_t direction = inputTileElement->GetDirection();
-    ride_ratings_score_close_proximity_in_direction(inputTileElement, (direction + 1) & 3);
-    ride_ratings_score_close_proximity_in_direction(inputTileElement, (direction - 1) & 3);
-    ride_ratings_score_close_proximity_loops(inputTileElement);
+    ride_ratings_score_close_proximity_in_direction(calcData, inputTileElement, (direction + 1) & 3);
+    ride_ratings_score_close_proximity_in_direction(calcData, inputTileElement, (direction - 1) & 3);
+    ride_ratings_score_close_proximity_loops(calcData, inputTileElement);
 
-    switch (gRideRatingsCalcData.proximity_track_type)
+    switch (calcData.proximity_track_type)
     {
         case TRACK_ELEM_BRAKES:
-            gRideRatingsCalcData.num_brakes++;
+            calcData.num_brakes++;
             break;
         case TRACK_ELEM_LEFT_REVERSER:
         case TRACK_ELEM_RIGHT_REVERSER:
-            gRideRatingsCalcData.num_reversers++;
+            calcData.num_reversers++;
             break;
     }
 }
 
-static void ride_ratings_calculate(Ride* ride)
+static void ride_ratings_calculate(Ride* ride, RideRatingCalculationData& calcData)
 {
     auto calcFunc = ride_ratings_get_calculate_func(ride->type);
     if (calcFunc != nullptr)
     {
-        calcFunc(ride);
+        calcFunc(ride, calcData);
     }
 
 #ifdef ORIGINAL_RATINGS
@@ -760,7 +807,14 @@ static void ride_ratings_calculate(Ride* ride)
         ride->ratings.nausea = max(0, ride->ratings.nausea);
     }
 #endif
+}
 
+/**
+ * Runs the parts of a ratings calculation that depend on the rest of the game: the script hooks, the ride value and the
+ * ride window. These always run on the main thread, in ride order.
+ */
+static void ride_ratings_finish(Ride* ride)
+{
 #ifdef ENABLE_SCRIPTING
     auto& hookEngine = GetContext()->GetScriptEngine().GetHookEngine();
     if (hookEngine.HasSubscriptions(HOOK_TYPE::RIDE_RATINGS_CALCULATE))
@@ -790,6 +844,9 @@ static void ride_ratings_calculate(Ride* ride)
         ride->nausea = std::clamp<int32_t>(scriptNausea, 0, INT16_MAX);
     }
 #endif
+
+    ride_ratings_calculate_value(ride);
+    window_invalidate_by_number(WC_RIDE, ride->id);
 }
 
 static void ride_ratings_calculate_value(Ride* ride)
@@ -890,7 +947,7 @@ static void ride_ratings_calculate_value(Ride* ride)
  * inputs
  * - edi: ride ptr
  */
-static uint16_t ride_compute_upkeep(Ride* ride)
+static uint16_t ride_compute_upkeep(Ride* ride, const RideRatingCalculationData& calcData)
 {
     // data stored at 0x0057E3A8, incrementing 18 bytes at a time
     uint16_t upkeep = RideTypeDescriptors[ride->type].UpkeepCosts.BaseCost;
@@ -926,10 +983,10 @@ static uint16_t ride_compute_upkeep(Ride* ride)
     {
         reverserMaintenanceCost = 10;
     }
-    upkeep += reverserMaintenanceCost * gRideRatingsCalcData.num_reversers;
+    upkeep += reverserMaintenanceCost * calcData.num_reversers;
 
     // Add maintenance cost for brake track pieces
-    upkeep += 20 * gRideRatingsCalcData.num_brakes;
+    upkeep += 20 * calcData.num_brakes;
 
     // these seem to be adhoc adjustments to a ride's upkeep/cost, times
     // various variables set on the ride itself.
@@ -1082,9 +1139,9 @@ static uint32_t get_proximity_score_helper_3(uint16_t x, uint16_t resultIfNotZer
  *
  *  rct2: 0x0065E277
  */
-static uint32_t ride_ratings_get_proximity_score()
+static uint32_t ride_ratings_get_proximity_score(const RideRatingCalculationData& calcData)
 {
-    const uint16_t* scores = gRideRatingsCalcData.proximity_scores;
+    const uint16_t* scores = calcData.proximity_scores;
 
     uint32_t result = 0;
     result += get_proximity_score_helper_1(scores[PROXIMITY_WATER_OVER], 60, 0x00AAAA);
@@ -1615,9 +1672,10 @@ static void ride_ratings_apply_rotations(
         ride->rotations * nauseaMultiplier);
 }
 
-static void ride_ratings_apply_proximity(RatingTuple* ratings, int32_t excitementMultiplier)
+static void ride_ratings_apply_proximity(
+    RatingTuple* ratings, int32_t excitementMultiplier, const RideRatingCalculationData& calcData)
 {
-    ride_ratings_add(ratings, (ride_ratings_get_proximity_score() * excitementMultiplier) >> 16, 0, 0);
+    ride_ratings_add(ratings, (ride_ratings_get_proximity_score(calcData) * excitementMultiplier) >> 16, 0, 0);
 }
 
 static void ride_ratings_apply_scenery(RatingTuple* ratings, Ride* ride, int32_t excitementMultiplier)
@@ -1742,7 +1800,7 @@ static void ride_ratings_apply_first_length_penalty(
 
 #pragma region Ride rating calculation functions
 
-void ride_ratings_calculate_spiral_roller_coaster(Ride* ride)
+void ride_ratings_calculate_spiral_roller_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -1762,7 +1820,7 @@ void ride_ratings_calculate_spiral_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 28235, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 43690, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(&ratings, 20130, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 6693);
 
     if (ride->inversions == 0)
@@ -1782,13 +1840,13 @@ void ride_ratings_calculate_spiral_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_stand_up_roller_coaster(Ride* ride)
+void ride_ratings_calculate_stand_up_roller_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -1808,7 +1866,7 @@ void ride_ratings_calculate_stand_up_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 34952, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 12850, 28398, 30427);
-    ride_ratings_apply_proximity(&ratings, 17893);
+    ride_ratings_apply_proximity(&ratings, 17893, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 5577);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 12, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
@@ -1820,13 +1878,13 @@ void ride_ratings_calculate_stand_up_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_suspended_swinging_coaster(Ride* ride)
+void ride_ratings_calculate_suspended_swinging_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -1846,7 +1904,7 @@ void ride_ratings_calculate_suspended_swinging_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 48036);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(&ratings, 20130, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 6971);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 8, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xC0000, 2, 2, 2);
@@ -1860,13 +1918,13 @@ void ride_ratings_calculate_suspended_swinging_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_inverted_roller_coaster(Ride* ride)
+void ride_ratings_calculate_inverted_roller_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -1886,7 +1944,7 @@ void ride_ratings_calculate_inverted_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 29552, 57186);
     ride_ratings_apply_drops(&ratings, ride, 29127, 39009, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 15291, 35108);
-    ride_ratings_apply_proximity(&ratings, 15657);
+    ride_ratings_apply_proximity(&ratings, 15657, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 8366);
 
     if (ride->inversions == 0)
@@ -1903,13 +1961,13 @@ void ride_ratings_calculate_inverted_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_junior_roller_coaster(Ride* ride)
+void ride_ratings_calculate_junior_roller_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -1929,7 +1987,7 @@ void ride_ratings_calculate_junior_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 25700, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(&ratings, 20130, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 9760);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 6, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x70000, 2, 2, 2);
@@ -1941,13 +1999,13 @@ void ride_ratings_calculate_junior_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_miniature_railway(Ride* ride)
+void ride_ratings_calculate_miniature_railway(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -1963,7 +2021,7 @@ void ride_ratings_calculate_miniature_railway(Ride* ride)
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
     ride_ratings_apply_duration(&ratings, ride, 150, 26214);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, -6425, 6553, 23405);
-    ride_ratings_apply_proximity(&ratings, 8946);
+    ride_ratings_apply_proximity(&ratings, 8946, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 20915);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0xC80000, 2, 2, 2);
 
@@ -1972,7 +2030,7 @@ void ride_ratings_calculate_miniature_railway(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     auto shelteredEighths = get_num_of_sheltered_eighths(ride);
@@ -1982,7 +2040,7 @@ void ride_ratings_calculate_miniature_railway(Ride* ride)
     ride->sheltered_eighths = shelteredEighths.TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_monorail(Ride* ride)
+void ride_ratings_calculate_monorail(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -1998,7 +2056,7 @@ void ride_ratings_calculate_monorail(Ride* ride)
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 218453);
     ride_ratings_apply_duration(&ratings, ride, 150, 21845);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 5140, 6553, 18724);
-    ride_ratings_apply_proximity(&ratings, 8946);
+    ride_ratings_apply_proximity(&ratings, 8946, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 16732);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0xAA0000, 2, 2, 2);
 
@@ -2007,7 +2065,7 @@ void ride_ratings_calculate_monorail(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     auto shelteredEighths = get_num_of_sheltered_eighths(ride);
@@ -2017,7 +2075,7 @@ void ride_ratings_calculate_monorail(Ride* ride)
     ride->sheltered_eighths = shelteredEighths.TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_mini_suspended_coaster(Ride* ride)
+void ride_ratings_calculate_mini_suspended_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2037,7 +2095,7 @@ void ride_ratings_calculate_mini_suspended_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 34179, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 58254, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 19275, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(&ratings, 20130, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 13943);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 6, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x80000, 2, 2, 2);
@@ -2050,13 +2108,13 @@ void ride_ratings_calculate_mini_suspended_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_boat_hire(Ride* ride)
+void ride_ratings_calculate_boat_hire(Ride* ride, RideRatingCalculationData& calcData)
 {
     ride->unreliability_factor = 7;
     set_unreliability_factor(ride);
@@ -2074,7 +2132,7 @@ void ride_ratings_calculate_boat_hire(Ride* ride)
         ride_ratings_add(&ratings, RIDE_RATING(0, 20), 0, 0);
     }
 
-    ride_ratings_apply_proximity(&ratings, 11183);
+    ride_ratings_apply_proximity(&ratings, 11183, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 22310);
 
     ride_ratings_apply_intensity_penalty(&ratings);
@@ -2082,13 +2140,13 @@ void ride_ratings_calculate_boat_hire(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = 0;
 }
 
-void ride_ratings_calculate_wooden_wild_mouse(Ride* ride)
+void ride_ratings_calculate_wooden_wild_mouse(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2108,7 +2166,7 @@ void ride_ratings_calculate_wooden_wild_mouse(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 29721, 43458, 45749);
     ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 17893);
+    ride_ratings_apply_proximity(&ratings, 17893, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 5577);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 8, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x70000, 2, 2, 2);
@@ -2123,13 +2181,13 @@ void ride_ratings_calculate_wooden_wild_mouse(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_steeplechase(Ride* ride)
+void ride_ratings_calculate_steeplechase(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2149,7 +2207,7 @@ void ride_ratings_calculate_steeplechase(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 25700, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(&ratings, 20130, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 9760);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 4, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x80000, 2, 2, 2);
@@ -2163,13 +2221,13 @@ void ride_ratings_calculate_steeplechase(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_car_ride(Ride* ride)
+void ride_ratings_calculate_car_ride(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2188,7 +2246,7 @@ void ride_ratings_calculate_car_ride(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 14860, 0, 11437);
     ride_ratings_apply_drops(&ratings, ride, 8738, 0, 0);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 12850, 6553, 4681);
-    ride_ratings_apply_proximity(&ratings, 11183);
+    ride_ratings_apply_proximity(&ratings, 11183, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 8366);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0xC80000, 8, 2, 2);
 
@@ -2197,13 +2255,13 @@ void ride_ratings_calculate_car_ride(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_launched_freefall(Ride* ride)
+void ride_ratings_calculate_launched_freefall(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2240,7 +2298,7 @@ void ride_ratings_calculate_launched_freefall(Ride* ride)
     }
 #endif
 
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(&ratings, 20130, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 25098);
 
     ride_ratings_apply_intensity_penalty(&ratings);
@@ -2248,13 +2306,13 @@ void ride_ratings_calculate_launched_freefall(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_bobsleigh_coaster(Ride* ride)
+void ride_ratings_calculate_bobsleigh_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2274,7 +2332,7 @@ void ride_ratings_calculate_bobsleigh_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(&ratings, 20130, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 5577);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xC0000, 2, 2, 2);
     ride_ratings_apply_max_lateral_g_penalty(&ratings, ride, FIXED_2DP(1, 20), 2, 2, 2);
@@ -2286,13 +2344,13 @@ void ride_ratings_calculate_bobsleigh_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_observation_tower(Ride* ride)
+void ride_ratings_calculate_observation_tower(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2304,7 +2362,7 @@ void ride_ratings_calculate_observation_tower(Ride* ride)
     ride_ratings_set(&ratings, RIDE_RATING(1, 50), RIDE_RATING(0, 00), RIDE_RATING(0, 10));
     ride_ratings_add(
         &ratings, ((ride_get_total_length(ride) >> 16) * 45875) >> 16, 0, ((ride_get_total_length(ride) >> 16) * 26214) >> 16);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(&ratings, 20130, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 83662);
 
     ride_ratings_apply_intensity_penalty(&ratings);
@@ -2312,7 +2370,7 @@ void ride_ratings_calculate_observation_tower(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = 7;
@@ -2322,7 +2380,7 @@ void ride_ratings_calculate_observation_tower(Ride* ride)
         ride->excitement /= 4;
 }
 
-void ride_ratings_calculate_looping_roller_coaster(Ride* ride)
+void ride_ratings_calculate_looping_roller_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2342,7 +2400,7 @@ void ride_ratings_calculate_looping_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(&ratings, 20130, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 6693);
 
     if (ride->inversions == 0)
@@ -2362,13 +2420,13 @@ void ride_ratings_calculate_looping_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_dinghy_slide(Ride* ride)
+void ride_ratings_calculate_dinghy_slide(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2388,7 +2446,7 @@ void ride_ratings_calculate_dinghy_slide(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 11183);
+    ride_ratings_apply_proximity(&ratings, 11183, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 5577);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 12, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x70000, 2, 2, 2);
@@ -2400,13 +2458,13 @@ void ride_ratings_calculate_dinghy_slide(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_mine_train_coaster(Ride* ride)
+void ride_ratings_calculate_mine_train_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2426,7 +2484,7 @@ void ride_ratings_calculate_mine_train_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 29721, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 19275, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 21472);
+    ride_ratings_apply_proximity(&ratings, 21472, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 16732);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 8, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
@@ -2440,13 +2498,13 @@ void ride_ratings_calculate_mine_train_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_chairlift(Ride* ride)
+void ride_ratings_calculate_chairlift(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2463,7 +2521,7 @@ void ride_ratings_calculate_chairlift(Ride* ride)
     ride_ratings_apply_duration(&ratings, ride, 150, 26214);
     ride_ratings_apply_turns(&ratings, ride, 7430, 3476, 4574);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, -19275, 21845, 23405);
-    ride_ratings_apply_proximity(&ratings, 11183);
+    ride_ratings_apply_proximity(&ratings, 11183, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 25098);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0x960000, 2, 2, 2);
 
@@ -2478,7 +2536,7 @@ void ride_ratings_calculate_chairlift(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     auto shelteredEighths = get_num_of_sheltered_eighths(ride);
@@ -2488,7 +2546,7 @@ void ride_ratings_calculate_chairlift(Ride* ride)
     ride->sheltered_eighths = shelteredEighths.TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_corkscrew_roller_coaster(Ride* ride)
+void ride_ratings_calculate_corkscrew_roller_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2508,7 +2566,7 @@ void ride_ratings_calculate_corkscrew_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(&ratings, 20130, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 6693);
 
     if (ride->inversions == 0)
@@ -2528,13 +2586,13 @@ void ride_ratings_calculate_corkscrew_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_maze(Ride* ride)
+void ride_ratings_calculate_maze(Ride* ride, RideRatingCalculationData& calcData)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -2554,13 +2612,13 @@ void ride_ratings_calculate_maze(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = 0;
 }
 
-void ride_ratings_calculate_spiral_slide(Ride* ride)
+void ride_ratings_calculate_spiral_slide(Ride* ride, RideRatingCalculationData& calcData)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -2583,13 +2641,13 @@ void ride_ratings_calculate_spiral_slide(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = 2;
 }
 
-void ride_ratings_calculate_go_karts(Ride* ride)
+void ride_ratings_calculate_go_karts(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2612,7 +2670,7 @@ void ride_ratings_calculate_go_karts(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 4458, 3476, 5718);
     ride_ratings_apply_drops(&ratings, ride, 8738, 5461, 6553);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 2570, 8738, 2340);
-    ride_ratings_apply_proximity(&ratings, 11183);
+    ride_ratings_apply_proximity(&ratings, 11183, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 16732);
 
     ride_ratings_apply_intensity_penalty(&ratings);
@@ -2620,7 +2678,7 @@ void ride_ratings_calculate_go_karts(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     auto shelteredEighths = get_num_of_sheltered_eighths(ride);
@@ -2630,7 +2688,7 @@ void ride_ratings_calculate_go_karts(Ride* ride)
         ride->excitement /= 2;
 }
 
-void ride_ratings_calculate_log_flume(Ride* ride)
+void ride_ratings_calculate_log_flume(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2647,7 +2705,7 @@ void ride_ratings_calculate_log_flume(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 22291, 20860, 4574);
     ride_ratings_apply_drops(&ratings, ride, 69905, 62415, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 22367);
+    ride_ratings_apply_proximity(&ratings, 22367, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 11155);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 2, 2, 2, 2);
 
@@ -2656,13 +2714,13 @@ void ride_ratings_calculate_log_flume(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_river_rapids(Ride* ride)
+void ride_ratings_calculate_river_rapids(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -2679,7 +2737,7 @@ void ride_ratings_calculate_river_rapids(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 29721, 22598, 5718);
     ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 31314);
+    ride_ratings_apply_proximity(&ratings, 31314, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 13943);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 2, 2, 2, 2);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0xC80000, 2, 2, 2);
@@ -2689,13 +2747,13 @@ void ride_ratings_calculate_river_rapids(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_dodgems(Ride* ride)
+void ride_ratings_calculate_dodgems(Ride* ride, RideRatingCalculationData& calcData)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -2724,13 +2782,13 @@ void ride_ratings_calculate_dodgems(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = 7;
 }
 
-void ride_ratings_calculate_pirate_ship(Ride* ride)
+void ride_ratings_calculate_pirate_ship(Ride* ride, RideRatingCalculationData& calcData)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -2749,13 +2807,13 @@ void ride_ratings_calculate_pirate_ship(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = 0;
 }
 
-void ride_ratings_calculate_inverter_ship(Ride* ride)
+void ride_ratings_calculate_inverter_ship(Ride* ride, RideRatingCalculationData& calcData)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -2774,31 +2832,31 @@ void ride_ratings_calculate_inverter_ship(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = 0;
 }
 
-void ride_ratings_calculate_food_stall(Ride* ride)
+void ride_ratings_calculate_food_stall(Ride* ride, RideRatingCalculationData& calcData)
 {
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 }
 
-void ride_ratings_calculate_drink_stall(Ride* ride)
+void ride_ratings_calculate_drink_stall(Ride* ride, RideRatingCalculationData& calcData)
 {
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 }
 
-void ride_ratings_calculate_shop(Ride* ride)
+void ride_ratings_calculate_shop(Ride* ride, RideRatingCalculationData& calcData)
 {
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 }
 
-void ride_ratings_calculate_merry_go_round(Ride* ride)
+void ride_ratings_calculate_merry_go_round(Ride* ride, RideRatingCalculationData& calcData)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -2814,25 +2872,25 @@ void ride_ratings_calculate_merry_go_round(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = 7;
 }
 
-void ride_ratings_calculate_information_kiosk(Ride* ride)
+void ride_ratings_calculate_information_kiosk(Ride* ride, RideRatingCalculationData& calcData)
 {
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 }
 
-void ride_ratings_calculate_toilets(Ride* ride)
+void ride_ratings_calculate_toilets(Ride* ride, RideRatingCalculationData& calcData)
 {
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 }
 
-void ride_ratings_calculate_ferris_wheel(Ride* ride)
+void ride_ratings_calculate_ferris_wheel(Ride* ride, RideRatingCalculationData& calcData)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -2848,13 +2906,13 @@ void ride_ratings_calculate_ferris_wheel(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = 0;
 }
 
-void ride_ratings_calculate_motion_simulator(Ride* ride)
+void ride_ratings_calculate_motion_simulator(Ride* ride, RideRatingCalculationData& calcData)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -2881,13 +2939,13 @@ void ride_ratings_calculate_motion_simulator(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = 7;
 }
 
-void ride_ratings_calculate_3d_cinema(Ride* ride)
+void ride_ratings_calculate_3d_cinema(Ride* ride, RideRatingCalculationData& calcData)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -2921,13 +2979,13 @@ void ride_ratings_calculate_3d_cinema(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths |= 7;
 }
 
-void ride_ratings_calculate_top_spin(Ride* ride)
+void ride_ratings_calculate_top_spin(Ride* ride, RideRatingCalculationData& calcData)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -2963,13 +3021,13 @@ void ride_ratings_calculate_top_spin(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = 0;
 }
 
-void ride_ratings_calculate_space_rings(Ride* ride)
+void ride_ratings_calculate_space_rings(Ride* ride, RideRatingCalculationData& calcData)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -2985,13 +3043,13 @@ void ride_ratings_calculate_space_rings(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = 0;
 }
 
-void ride_ratings_calculate_reverse_freefall_coaster(Ride* ride)
+void ride_ratings_calculate_reverse_freefall_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3006,7 +3064,7 @@ void ride_ratings_calculate_reverse_freefall_coaster(Ride* ride)
     ride_ratings_apply_max_speed(&ratings, ride, 436906, 436906, 320398);
     ride_ratings_apply_gforces(&ratings, ride, 24576, 41704, 59578);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 12850, 28398, 11702);
-    ride_ratings_apply_proximity(&ratings, 17893);
+    ride_ratings_apply_proximity(&ratings, 17893, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 11155);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 34, 2, 2, 2);
 
@@ -3015,13 +3073,13 @@ void ride_ratings_calculate_reverse_freefall_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_lift(Ride* ride)
+void ride_ratings_calculate_lift(Ride* ride, RideRatingCalculationData& calcData)
 {
     int32_t totalLength;
 
@@ -3037,7 +3095,7 @@ void ride_ratings_calculate_lift(Ride* ride)
     totalLength = ride_get_total_length(ride) >> 16;
     ride_ratings_add(&ratings, (totalLength * 45875) >> 16, 0, (totalLength * 26214) >> 16);
 
-    ride_ratings_apply_proximity(&ratings, 11183);
+    ride_ratings_apply_proximity(&ratings, 11183, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 83662);
 
     ride_ratings_apply_intensity_penalty(&ratings);
@@ -3045,7 +3103,7 @@ void ride_ratings_calculate_lift(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = 7;
@@ -3054,7 +3112,7 @@ void ride_ratings_calculate_lift(Ride* ride)
         ride->excitement /= 4;
 }
 
-void ride_ratings_calculate_vertical_drop_roller_coaster(Ride* ride)
+void ride_ratings_calculate_vertical_drop_roller_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3073,7 +3131,7 @@ void ride_ratings_calculate_vertical_drop_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 58254, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(&ratings, 20130, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 6693);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 20, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
@@ -3086,19 +3144,19 @@ void ride_ratings_calculate_vertical_drop_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_cash_machine(Ride* ride)
+void ride_ratings_calculate_cash_machine(Ride* ride, RideRatingCalculationData& calcData)
 {
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 }
 
-void ride_ratings_calculate_twist(Ride* ride)
+void ride_ratings_calculate_twist(Ride* ride, RideRatingCalculationData& calcData)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -3114,13 +3172,13 @@ void ride_ratings_calculate_twist(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = 0;
 }
 
-void ride_ratings_calculate_haunted_house(Ride* ride)
+void ride_ratings_calculate_haunted_house(Ride* ride, RideRatingCalculationData& calcData)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -3138,13 +3196,13 @@ void ride_ratings_calculate_haunted_house(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = 7;
 }
 
-void ride_ratings_calculate_flying_roller_coaster(Ride* ride)
+void ride_ratings_calculate_flying_roller_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3164,7 +3222,7 @@ void ride_ratings_calculate_flying_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(&ratings, 20130, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 6693);
 
     if (ride->inversions == 0)
@@ -3183,13 +3241,13 @@ void ride_ratings_calculate_flying_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_virginia_reel(Ride* ride)
+void ride_ratings_calculate_virginia_reel(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3209,7 +3267,7 @@ void ride_ratings_calculate_virginia_reel(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 52012, 26075, 45749);
     ride_ratings_apply_drops(&ratings, ride, 43690, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 22367);
+    ride_ratings_apply_proximity(&ratings, 22367, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 11155);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0xD20000, 2, 2, 2);
     ride_ratings_apply_num_drops_penalty(&ratings, ride, 2, 2, 2, 2);
@@ -3220,13 +3278,13 @@ void ride_ratings_calculate_virginia_reel(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_splash_boats(Ride* ride)
+void ride_ratings_calculate_splash_boats(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3243,7 +3301,7 @@ void ride_ratings_calculate_splash_boats(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 22291, 20860, 4574);
     ride_ratings_apply_drops(&ratings, ride, 87381, 93622, 62259);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 22367);
+    ride_ratings_apply_proximity(&ratings, 22367, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 11155);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 6, 2, 2, 2);
 
@@ -3252,13 +3310,13 @@ void ride_ratings_calculate_splash_boats(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_mini_helicopters(Ride* ride)
+void ride_ratings_calculate_mini_helicopters(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3277,7 +3335,7 @@ void ride_ratings_calculate_mini_helicopters(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 14860, 0, 4574);
     ride_ratings_apply_drops(&ratings, ride, 8738, 0, 0);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 12850, 6553, 4681);
-    ride_ratings_apply_proximity(&ratings, 8946);
+    ride_ratings_apply_proximity(&ratings, 8946, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 8366);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0xA00000, 2, 2, 2);
 
@@ -3286,13 +3344,13 @@ void ride_ratings_calculate_mini_helicopters(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = 6;
 }
 
-void ride_ratings_calculate_lay_down_roller_coaster(Ride* ride)
+void ride_ratings_calculate_lay_down_roller_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3312,7 +3370,7 @@ void ride_ratings_calculate_lay_down_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(&ratings, 20130, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 6693);
 
     if (ride->inversions == 0)
@@ -3336,13 +3394,13 @@ void ride_ratings_calculate_lay_down_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_suspended_monorail(Ride* ride)
+void ride_ratings_calculate_suspended_monorail(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3358,7 +3416,7 @@ void ride_ratings_calculate_suspended_monorail(Ride* ride)
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 218453);
     ride_ratings_apply_duration(&ratings, ride, 150, 21845);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 5140, 6553, 18724);
-    ride_ratings_apply_proximity(&ratings, 12525);
+    ride_ratings_apply_proximity(&ratings, 12525, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 25098);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0xAA0000, 2, 2, 2);
 
@@ -3367,7 +3425,7 @@ void ride_ratings_calculate_suspended_monorail(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     auto shelteredEighths = get_num_of_sheltered_eighths(ride);
@@ -3377,7 +3435,7 @@ void ride_ratings_calculate_suspended_monorail(Ride* ride)
     ride->sheltered_eighths = shelteredEighths.TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_reverser_roller_coaster(Ride* ride)
+void ride_ratings_calculate_reverser_roller_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3393,7 +3451,7 @@ void ride_ratings_calculate_reverser_roller_coaster(Ride* ride)
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 364088, 655360);
 
-    int32_t numReversers = std::min<uint16_t>(gRideRatingsCalcData.num_reversers, 6);
+    int32_t numReversers = std::min<uint16_t>(calcData.num_reversers, 6);
     ride_rating reverserRating = numReversers * RIDE_RATING(0, 20);
     ride_ratings_add(&ratings, reverserRating, reverserRating, reverserRating);
 
@@ -3402,10 +3460,10 @@ void ride_ratings_calculate_reverser_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 43458, 45749);
     ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 22367);
+    ride_ratings_apply_proximity(&ratings, 22367, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 11155);
 
-    if (gRideRatingsCalcData.num_reversers < 1)
+    if (calcData.num_reversers < 1)
     {
         ratings.Excitement /= 8;
     }
@@ -3419,13 +3477,13 @@ void ride_ratings_calculate_reverser_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_heartline_twister_coaster(Ride* ride)
+void ride_ratings_calculate_heartline_twister_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3445,7 +3503,7 @@ void ride_ratings_calculate_heartline_twister_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 52150, 57186);
     ride_ratings_apply_drops(&ratings, ride, 29127, 53052, 55705);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 34952, 35108);
-    ride_ratings_apply_proximity(&ratings, 9841);
+    ride_ratings_apply_proximity(&ratings, 9841, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 3904);
 
     if (ride->inversions == 0)
@@ -3459,13 +3517,13 @@ void ride_ratings_calculate_heartline_twister_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_mini_golf(Ride* ride)
+void ride_ratings_calculate_mini_golf(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3478,7 +3536,7 @@ void ride_ratings_calculate_mini_golf(Ride* ride)
     ride_ratings_apply_length(&ratings, ride, 6000, 873);
     ride_ratings_apply_turns(&ratings, ride, 14860, 0, 0);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 5140, 6553, 4681);
-    ride_ratings_apply_proximity(&ratings, 15657);
+    ride_ratings_apply_proximity(&ratings, 15657, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 27887);
 
     // Apply golf holes factor
@@ -3497,19 +3555,19 @@ void ride_ratings_calculate_mini_golf(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_first_aid(Ride* ride)
+void ride_ratings_calculate_first_aid(Ride* ride, RideRatingCalculationData& calcData)
 {
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 }
 
-void ride_ratings_calculate_circus_show(Ride* ride)
+void ride_ratings_calculate_circus_show(Ride* ride, RideRatingCalculationData& calcData)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -3527,13 +3585,13 @@ void ride_ratings_calculate_circus_show(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = 7;
 }
 
-void ride_ratings_calculate_ghost_train(Ride* ride)
+void ride_ratings_calculate_ghost_train(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3551,7 +3609,7 @@ void ride_ratings_calculate_ghost_train(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 14860, 0, 11437);
     ride_ratings_apply_drops(&ratings, ride, 8738, 0, 0);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 25700, 6553, 4681);
-    ride_ratings_apply_proximity(&ratings, 11183);
+    ride_ratings_apply_proximity(&ratings, 11183, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 8366);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0xB40000, 2, 2, 2);
 
@@ -3560,13 +3618,13 @@ void ride_ratings_calculate_ghost_train(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_twister_roller_coaster(Ride* ride)
+void ride_ratings_calculate_twister_roller_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3586,7 +3644,7 @@ void ride_ratings_calculate_twister_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(&ratings, 20130, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 6693);
 
     if (ride->inversions == 0)
@@ -3606,13 +3664,13 @@ void ride_ratings_calculate_twister_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_wooden_roller_coaster(Ride* ride)
+void ride_ratings_calculate_wooden_roller_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3632,7 +3690,7 @@ void ride_ratings_calculate_wooden_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 43458, 45749);
     ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 22367);
+    ride_ratings_apply_proximity(&ratings, 22367, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 11155);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 12, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
@@ -3646,13 +3704,13 @@ void ride_ratings_calculate_wooden_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_side_friction_roller_coaster(Ride* ride)
+void ride_ratings_calculate_side_friction_roller_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3672,7 +3730,7 @@ void ride_ratings_calculate_side_friction_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 43458, 45749);
     ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 22367);
+    ride_ratings_apply_proximity(&ratings, 22367, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 11155);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 6, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x50000, 2, 2, 2);
@@ -3685,13 +3743,13 @@ void ride_ratings_calculate_side_friction_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_wild_mouse(Ride* ride)
+void ride_ratings_calculate_wild_mouse(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3711,7 +3769,7 @@ void ride_ratings_calculate_wild_mouse(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 29721, 43458, 45749);
     ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 17893);
+    ride_ratings_apply_proximity(&ratings, 17893, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 5577);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 6, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x70000, 2, 2, 2);
@@ -3725,13 +3783,13 @@ void ride_ratings_calculate_wild_mouse(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_multi_dimension_roller_coaster(Ride* ride)
+void ride_ratings_calculate_multi_dimension_roller_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3751,7 +3809,7 @@ void ride_ratings_calculate_multi_dimension_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(&ratings, 20130, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 6693);
 
     if (ride->inversions == 0)
@@ -3770,13 +3828,13 @@ void ride_ratings_calculate_multi_dimension_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_giga_coaster(Ride* ride)
+void ride_ratings_calculate_giga_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3796,7 +3854,7 @@ void ride_ratings_calculate_giga_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 28235, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 43690, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(&ratings, 20130, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 6693);
 
     if (ride->inversions == 0)
@@ -3816,13 +3874,13 @@ void ride_ratings_calculate_giga_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_roto_drop(Ride* ride)
+void ride_ratings_calculate_roto_drop(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3836,7 +3894,7 @@ void ride_ratings_calculate_roto_drop(Ride* ride)
     int32_t lengthFactor = ((ride_get_total_length(ride) >> 16) * 209715) >> 16;
     ride_ratings_add(&ratings, lengthFactor, lengthFactor * 2, lengthFactor * 2);
 
-    ride_ratings_apply_proximity(&ratings, 11183);
+    ride_ratings_apply_proximity(&ratings, 11183, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 25098);
 
     ride_ratings_apply_intensity_penalty(&ratings);
@@ -3844,13 +3902,13 @@ void ride_ratings_calculate_roto_drop(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_flying_saucers(Ride* ride)
+void ride_ratings_calculate_flying_saucers(Ride* ride, RideRatingCalculationData& calcData)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -3882,13 +3940,13 @@ void ride_ratings_calculate_flying_saucers(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = 0;
 }
 
-void ride_ratings_calculate_crooked_house(Ride* ride)
+void ride_ratings_calculate_crooked_house(Ride* ride, RideRatingCalculationData& calcData)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -3906,13 +3964,13 @@ void ride_ratings_calculate_crooked_house(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = 7;
 }
 
-void ride_ratings_calculate_monorail_cycles(Ride* ride)
+void ride_ratings_calculate_monorail_cycles(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3931,7 +3989,7 @@ void ride_ratings_calculate_monorail_cycles(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 14860, 0, 4574);
     ride_ratings_apply_drops(&ratings, ride, 8738, 0, 0);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 5140, 6553, 2340);
-    ride_ratings_apply_proximity(&ratings, 8946);
+    ride_ratings_apply_proximity(&ratings, 8946, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 11155);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0x8C0000, 2, 2, 2);
 
@@ -3940,13 +3998,13 @@ void ride_ratings_calculate_monorail_cycles(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_compact_inverted_coaster(Ride* ride)
+void ride_ratings_calculate_compact_inverted_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3966,7 +4024,7 @@ void ride_ratings_calculate_compact_inverted_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 29552, 57186);
     ride_ratings_apply_drops(&ratings, ride, 29127, 39009, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 15291, 35108);
-    ride_ratings_apply_proximity(&ratings, 15657);
+    ride_ratings_apply_proximity(&ratings, 15657, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 8366);
 
     if (ride->inversions == 0)
@@ -3983,13 +4041,13 @@ void ride_ratings_calculate_compact_inverted_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_water_coaster(Ride* ride)
+void ride_ratings_calculate_water_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -4009,7 +4067,7 @@ void ride_ratings_calculate_water_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 25700, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(&ratings, 20130, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 9760);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 8, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x70000, 2, 2, 2);
@@ -4024,13 +4082,13 @@ void ride_ratings_calculate_water_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_air_powered_vertical_coaster(Ride* ride)
+void ride_ratings_calculate_air_powered_vertical_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -4045,7 +4103,7 @@ void ride_ratings_calculate_air_powered_vertical_coaster(Ride* ride)
     ride_ratings_apply_max_speed(&ratings, ride, 509724, 364088, 320398);
     ride_ratings_apply_gforces(&ratings, ride, 24576, 35746, 59578);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 21845, 11702);
-    ride_ratings_apply_proximity(&ratings, 17893);
+    ride_ratings_apply_proximity(&ratings, 17893, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 11155);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 34, 2, 1, 1);
 
@@ -4055,13 +4113,13 @@ void ride_ratings_calculate_air_powered_vertical_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_inverted_hairpin_coaster(Ride* ride)
+void ride_ratings_calculate_inverted_hairpin_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -4081,7 +4139,7 @@ void ride_ratings_calculate_inverted_hairpin_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 29721, 43458, 45749);
     ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 17893);
+    ride_ratings_apply_proximity(&ratings, 17893, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 5577);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 8, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x70000, 2, 2, 2);
@@ -4096,13 +4154,13 @@ void ride_ratings_calculate_inverted_hairpin_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_magic_carpet(Ride* ride)
+void ride_ratings_calculate_magic_carpet(Ride* ride, RideRatingCalculationData& calcData)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -4121,13 +4179,13 @@ void ride_ratings_calculate_magic_carpet(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = 0;
 }
 
-void ride_ratings_calculate_submarine_ride(Ride* ride)
+void ride_ratings_calculate_submarine_ride(Ride* ride, RideRatingCalculationData& calcData)
 {
     ride->unreliability_factor = 7;
     set_unreliability_factor(ride);
@@ -4137,7 +4195,7 @@ void ride_ratings_calculate_submarine_ride(Ride* ride)
     RatingTuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 20), RIDE_RATING(1, 80), RIDE_RATING(1, 40));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_proximity(&ratings, 11183);
+    ride_ratings_apply_proximity(&ratings, 11183, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 22310);
 
     ride_ratings_apply_intensity_penalty(&ratings);
@@ -4145,14 +4203,14 @@ void ride_ratings_calculate_submarine_ride(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     // Originally, this was always to zero, even though the default vehicle is completely enclosed.
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_river_rafts(Ride* ride)
+void ride_ratings_calculate_river_rafts(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -4168,7 +4226,7 @@ void ride_ratings_calculate_river_rafts(Ride* ride)
     ride_ratings_apply_duration(&ratings, ride, 500, 13107);
     ride_ratings_apply_turns(&ratings, ride, 22291, 20860, 4574);
     ride_ratings_apply_drops(&ratings, ride, 78643, 93622, 62259);
-    ride_ratings_apply_proximity(&ratings, 13420);
+    ride_ratings_apply_proximity(&ratings, 13420, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 11155);
 
     ride_ratings_apply_intensity_penalty(&ratings);
@@ -4176,13 +4234,13 @@ void ride_ratings_calculate_river_rafts(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_enterprise(Ride* ride)
+void ride_ratings_calculate_enterprise(Ride* ride, RideRatingCalculationData& calcData)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
@@ -4205,13 +4263,13 @@ void ride_ratings_calculate_enterprise(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = 3;
 }
 
-void ride_ratings_calculate_inverted_impulse_coaster(Ride* ride)
+void ride_ratings_calculate_inverted_impulse_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -4231,7 +4289,7 @@ void ride_ratings_calculate_inverted_impulse_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 29552, 57186);
     ride_ratings_apply_drops(&ratings, ride, 29127, 39009, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 15291, 35108);
-    ride_ratings_apply_proximity(&ratings, 15657);
+    ride_ratings_apply_proximity(&ratings, 15657, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 9760);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 20, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
@@ -4242,13 +4300,13 @@ void ride_ratings_calculate_inverted_impulse_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_mini_roller_coaster(Ride* ride)
+void ride_ratings_calculate_mini_roller_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -4268,7 +4326,7 @@ void ride_ratings_calculate_mini_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 25700, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(&ratings, 20130, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 9760);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 12, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x70000, 2, 2, 2);
@@ -4281,13 +4339,13 @@ void ride_ratings_calculate_mini_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_mine_ride(Ride* ride)
+void ride_ratings_calculate_mine_ride(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -4307,7 +4365,7 @@ void ride_ratings_calculate_mine_ride(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 29721, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 19275, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 21472);
+    ride_ratings_apply_proximity(&ratings, 21472, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 16732);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0x10E0000, 2, 2, 2);
 
@@ -4317,13 +4375,13 @@ void ride_ratings_calculate_mine_ride(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-void ride_ratings_calculate_lim_launched_roller_coaster(Ride* ride)
+void ride_ratings_calculate_lim_launched_roller_coaster(Ride* ride, RideRatingCalculationData& calcData)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -4343,7 +4401,7 @@ void ride_ratings_calculate_lim_launched_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_proximity(&ratings, 20130, calcData);
     ride_ratings_apply_scenery(&ratings, ride, 6693);
 
     if (ride->inversions == 0)
@@ -4363,7 +4421,7 @@ void ride_ratings_calculate_lim_launched_roller_coaster(Ride* ride)
 
     ride->ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->upkeep_cost = ride_compute_upkeep(ride, calcData);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
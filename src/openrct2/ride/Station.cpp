@@ -54,10 +54,15 @@ void ride_update_station(Ride* ride, StationIndex stationIndex)
  */
 static void ride_update_station_blocksection(Ride* ride, StationIndex stationIndex)
 {
-    TileElement* tileElement = ride_get_station_start_track_element(ride, stationIndex);
+    if (ride->status == RIDE_STATUS_CLOSED && ride->num_riders == 0)
+    {
+        ride->stations[stationIndex].Depart &= ~STATION_DEPART_FLAG;
+        ride_invalidate_station_start(ride, stationIndex, false);
+        return;
+    }
 
-    if ((ride->status == RIDE_STATUS_CLOSED && ride->num_riders == 0)
-        || (tileElement != nullptr && tileElement->AsTrack()->BlockBrakeClosed()))
+    TileElement* tileElement = ride_get_station_start_track_element(ride, stationIndex);
+    if (tileElement != nullptr && tileElement->AsTrack()->BlockBrakeClosed())
     {
         ride->stations[stationIndex].Depart &= ~STATION_DEPART_FLAG;
 
@@ -317,13 +322,26 @@ static void ride_race_init_vehicle_speeds(Ride* ride)
  */
 static void ride_invalidate_station_start(Ride* ride, StationIndex stationIndex, bool greenLight)
 {
-    auto startPos = ride->stations[stationIndex].Start;
+    auto& station = ride->stations[stationIndex];
+
+    // Closed rides set the light to red every tick. Only this function turns it green, and new station pieces start
+    // with it red, so there is nothing to do while the station has not moved since it was last set to red.
+    if (!greenLight && station.RedLightStart == station.GetStart())
+        return;
+
+    auto startPos = station.Start;
     TileElement* tileElement = ride_get_station_start_track_element(ride, stationIndex);
 
     // If no station track found return
     if (tileElement == nullptr)
         return;
 
+    station.RedLightStart = greenLight ? CoordsXYZ{ LOCATION_NULL, LOCATION_NULL, 0 } : station.GetStart();
+
+    // Stations are updated every tick, only redraw the tile when the light actually changes.
+    if (tileElement->AsTrack()->HasGreenLight() == greenLight)
+        return;
+
     tileElement->AsTrack()->SetHasGreenLight(greenLight);
 
     // Invalidate map tile
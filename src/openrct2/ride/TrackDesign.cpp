@@ -56,6 +56,7 @@
 #include "Track.h"
 #include "TrackData.h"
 #include "TrackDesignRepository.h"
+#include "TrackGraph.h"
 
 #include <algorithm>
 #include <iterator>
@@ -2139,6 +2140,8 @@ static void track_design_preview_restore_map(map_backup* backup)
     gMapSizeMinus2 = backup->map_size_units_minus_2;
     gMapSize = backup->map_size;
     gCurrentRotation = backup->current_rotation;
+
+    track_graph_invalidate();
 }
 
 /**
@@ -0,0 +1,349 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TrackGraph.h"
+
+#include "Ride.h"
+#include "Track.h"
+
+#include <algorithm>
+#include <array>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/** Where one element of a piece was found, Slot is its position among the elements of the tile. */
+struct TrackGraphElement
+{
+    CoordsXY Tile;
+    int32_t BaseZ = 0;
+    uint8_t Sequence = 0;
+    uint16_t Slot = 0;
+};
+
+struct TrackGraphPiece
+{
+    TrackGraphElement Origin;
+    track_type_t TrackType = 0;
+    uint8_t Direction = 0;
+
+    uint32_t Next = TRACK_GRAPH_PIECE_NULL;
+    int32_t NextDirection = 0;
+
+    // The outputs of track_block_get_previous, PreviousEnd is the last element of the previous piece.
+    uint32_t Previous = TRACK_GRAPH_PIECE_NULL;
+    TrackGraphElement PreviousEnd;
+    CoordsXYZ PreviousBegin;
+    int32_t PreviousBeginDirection = 0;
+    int32_t PreviousEndDirection = 0;
+};
+
+struct TrackGraphRide
+{
+    bool Dirty = true;
+    std::vector<TrackGraphPiece> Pieces;
+
+    // Piece indices sorted by origin and track type, for finding the piece a vehicle is on.
+    std::vector<std::pair<uint64_t, uint32_t>> PiecesByLocation;
+};
+
+static std::array<TrackGraphRide, MAX_RIDES> _rides;
+
+void track_graph_invalidate()
+{
+    for (auto& graph : _rides)
+    {
+        graph.Dirty = true;
+    }
+}
+
+void track_graph_invalidate_ride(ride_id_t rideIndex)
+{
+    if (rideIndex < MAX_RIDES)
+    {
+        _rides[rideIndex].Dirty = true;
+    }
+}
+
+static uint64_t track_graph_get_key(const CoordsXYZ& trackPos, int32_t trackType)
+{
+    auto tilePos = TileCoordsXYZ{ trackPos };
+    return (static_cast<uint64_t>(tilePos.x & 0xFFFF) << 48) | (static_cast<uint64_t>(tilePos.y & 0xFFFF) << 32)
+        | (static_cast<uint64_t>(tilePos.z & 0xFFFF) << 16) | static_cast<uint64_t>(trackType & 0xFFFF);
+}
+
+static bool track_graph_element_matches(
+    const TileElement* tileElement, ride_id_t rideIndex, const TrackGraphPiece& piece, const TrackGraphElement& ref)
+{
+    auto trackElement = tileElement->AsTrack();
+    return trackElement != nullptr && !tileElement->IsGhost() && trackElement->GetRideIndex() == rideIndex
+        && trackElement->GetTrackType() == piece.TrackType && trackElement->GetSequenceIndex() == ref.Sequence
+        && tileElement->GetBaseZ() == ref.BaseZ && tileElement->GetDirection() == piece.Direction;
+}
+
+static TrackGraphElement track_graph_get_element_ref(const CoordsXY& tile, const TileElement* tileElement)
+{
+    TrackGraphElement ref;
+    ref.Tile = tile;
+    ref.BaseZ = tileElement->GetBaseZ();
+    ref.Sequence = tileElement->AsTrack()->GetSequenceIndex();
+    ref.Slot = static_cast<uint16_t>(tileElement - map_get_first_element_at(tile));
+    return ref;
+}
+
+/**
+ * Returns the element ref points to. When it has moved within its tile the slot is updated, when it is gone the graph
+ * is out of date and will be rebuilt on the next lookup.
+ */
+static TileElement* track_graph_get_element(
+    TrackGraphRide& graph, ride_id_t rideIndex, const TrackGraphPiece& piece, TrackGraphElement& ref)
+{
+    TileElement* const firstElement = map_get_first_element_at(ref.Tile);
+    if (firstElement != nullptr)
+    {
+        // Stop at the end of the tile, the slot may be past it when elements before it have been removed.
+        TileElement* tileElement = firstElement;
+        uint16_t slot = 0;
+        while (slot < ref.Slot && !tileElement->IsLastForTile())
+        {
+            tileElement++;
+            slot++;
+        }
+        if (track_graph_element_matches(tileElement, rideIndex, piece, ref))
+        {
+            ref.Slot = slot;
+            return tileElement;
+        }
+
+        tileElement = firstElement;
+        slot = 0;
+        do
+        {
+            if (track_graph_element_matches(tileElement, rideIndex, piece, ref))
+            {
+                ref.Slot = slot;
+                return tileElement;
+            }
+            slot++;
+        } while (!(tileElement++)->IsLastForTile());
+    }
+
+    graph.Dirty = true;
+    return nullptr;
+}
+
+static TileElement* track_graph_find_origin(
+    ride_id_t rideIndex, const CoordsXYZ& trackPos, track_type_t trackType, Direction direction)
+{
+    TileElement* tileElement = map_get_first_element_at(trackPos);
+    if (tileElement == nullptr)
+        return nullptr;
+
+    do
+    {
+        auto trackElement = tileElement->AsTrack();
+        if (trackElement != nullptr && !tileElement->IsGhost() && trackElement->GetRideIndex() == rideIndex
+            && trackElement->GetTrackType() == trackType && trackElement->GetSequenceIndex() == 0
+            && tileElement->GetBaseZ() == trackPos.z && tileElement->GetDirection() == direction)
+        {
+            return tileElement;
+        }
+    } while (!(tileElement++)->IsLastForTile());
+    return nullptr;
+}
+
+/** Walks every piece that can be reached from the ride's stations, the pieces array doubles as the work list. */
+static void track_graph_build(TrackGraphRide& graph, ride_id_t rideIndex)
+{
+    graph.Dirty = false;
+    graph.Pieces.clear();
+    graph.PiecesByLocation.clear();
+
+    auto ride = get_ride(rideIndex);
+    if (ride == nullptr)
+        return;
+
+    std::vector<TileElement*> elements;
+    std::unordered_map<uint64_t, uint32_t> known;
+    auto addPiece = [&](const CoordsXY& tile, TileElement* tileElement) {
+        auto trackElement = tileElement->AsTrack();
+        auto key = track_graph_get_key({ tile, tileElement->GetBaseZ() }, trackElement->GetTrackType());
+        auto it = known.find(key);
+        if (it != known.end())
+            return it->second;
+
+        TrackGraphPiece piece;
+        piece.Origin = track_graph_get_element_ref(tile, tileElement);
+        piece.TrackType = trackElement->GetTrackType();
+        piece.Direction = tileElement->GetDirection();
+
+        auto index = static_cast<uint32_t>(graph.Pieces.size());
+        graph.Pieces.push_back(piece);
+        graph.PiecesByLocation.emplace_back(key, index);
+        elements.push_back(tileElement);
+        known.emplace(key, index);
+        return index;
+    };
+
+    for (StationIndex stationIndex = 0; stationIndex < MAX_STATIONS; stationIndex++)
+    {
+        if (ride->stations[stationIndex].Start.isNull())
+            continue;
+
+        auto tileElement = ride_get_station_start_track_element(ride, stationIndex);
+        if (tileElement == nullptr || tileElement->IsGhost() || tileElement->AsTrack()->GetRideIndex() != rideIndex
+            || tileElement->AsTrack()->GetSequenceIndex() != 0)
+        {
+            continue;
+        }
+        addPiece(ride->stations[stationIndex].Start, tileElement);
+    }
+
+    for (uint32_t index = 0; index < graph.Pieces.size(); index++)
+    {
+        auto tile = graph.Pieces[index].Origin.Tile;
+        CoordsXYE input = { tile, elements[index] };
+
+        CoordsXYE next;
+        int32_t nextZ, nextDirection;
+        if (track_block_get_next(&input, &next, &nextZ, &nextDirection))
+        {
+            auto nextIndex = addPiece(next, next.element);
+            graph.Pieces[index].Next = nextIndex;
+            graph.Pieces[index].NextDirection = nextDirection;
+        }
+
+        track_begin_end previous;
+        if (track_block_get_previous(input, &previous) && !previous.begin_element->IsGhost())
+        {
+            auto previousPos = CoordsXYZ{ previous.begin_x, previous.begin_y, previous.begin_z };
+            auto previousOrigin = track_graph_find_origin(
+                rideIndex, previousPos, previous.begin_element->AsTrack()->GetTrackType(),
+                previous.begin_element->GetDirection());
+            if (previousOrigin != nullptr)
+            {
+                auto previousIndex = addPiece(previousPos, previousOrigin);
+                auto& piece = graph.Pieces[index];
+                piece.Previous = previousIndex;
+                piece.PreviousEnd = track_graph_get_element_ref({ previous.end_x, previous.end_y }, previous.begin_element);
+                piece.PreviousBegin = previousPos;
+                piece.PreviousBeginDirection = previous.begin_direction;
+                piece.PreviousEndDirection = previous.end_direction;
+            }
+        }
+    }
+
+    std::sort(graph.PiecesByLocation.begin(), graph.PiecesByLocation.end());
+}
+
+static TrackGraphRide* track_graph_get_ride(ride_id_t rideIndex)
+{
+    if (rideIndex >= MAX_RIDES)
+        return nullptr;
+
+    auto& graph = _rides[rideIndex];
+    if (graph.Dirty)
+        return nullptr;
+    return &graph;
+}
+
+TrackGraphCursor track_graph_get_piece(ride_id_t rideIndex, const CoordsXYZ& trackPos, int32_t trackType)
+{
+    if (rideIndex < MAX_RIDES)
+    {
+        auto& graph = _rides[rideIndex];
+        if (graph.Dirty)
+        {
+            track_graph_build(graph, rideIndex);
+        }
+
+        auto key = track_graph_get_key(trackPos, trackType);
+        auto it = std::lower_bound(
+            graph.PiecesByLocation.begin(), graph.PiecesByLocation.end(), std::make_pair(key, uint32_t{ 0 }));
+        if (it != graph.PiecesByLocation.end() && it->first == key)
+        {
+            auto& piece = graph.Pieces[it->second];
+            auto tileElement = track_graph_get_element(graph, rideIndex, piece, piece.Origin);
+            if (tileElement != nullptr)
+            {
+                return { { piece.Origin.Tile, tileElement }, it->second };
+            }
+        }
+    }
+    return { { trackPos, map_get_track_element_at_of_type_seq(trackPos, trackType, 0) }, TRACK_GRAPH_PIECE_NULL };
+}
+
+bool track_graph_get_next(const TrackGraphCursor& input, TrackGraphCursor* output, int32_t* z, int32_t* direction)
+{
+    CoordsXYE inputElement = input.Element;
+    if (input.Piece != TRACK_GRAPH_PIECE_NULL && inputElement.element != nullptr)
+    {
+        auto rideIndex = inputElement.element->AsTrack()->GetRideIndex();
+        auto graph = track_graph_get_ride(rideIndex);
+        if (graph != nullptr && input.Piece < graph->Pieces.size())
+        {
+            const auto& piece = graph->Pieces[input.Piece];
+            if (piece.Next != TRACK_GRAPH_PIECE_NULL)
+            {
+                auto& next = graph->Pieces[piece.Next];
+                auto tileElement = track_graph_get_element(*graph, rideIndex, next, next.Origin);
+                if (tileElement != nullptr)
+                {
+                    if (z != nullptr)
+                        *z = next.Origin.BaseZ;
+                    if (direction != nullptr)
+                        *direction = piece.NextDirection;
+                    *output = { { next.Origin.Tile, tileElement }, piece.Next };
+                    return true;
+                }
+            }
+        }
+    }
+
+    CoordsXYE outputElement;
+    bool result = track_block_get_next(&inputElement, &outputElement, z, direction);
+    *output = { outputElement, TRACK_GRAPH_PIECE_NULL };
+    return result;
+}
+
+bool track_graph_get_previous(const TrackGraphCursor& input, track_begin_end* outTrackBeginEnd, uint32_t* outPiece)
+{
+    if (input.Piece != TRACK_GRAPH_PIECE_NULL && input.Element.element != nullptr)
+    {
+        auto rideIndex = input.Element.element->AsTrack()->GetRideIndex();
+        auto graph = track_graph_get_ride(rideIndex);
+        if (graph != nullptr && input.Piece < graph->Pieces.size())
+        {
+            auto& piece = graph->Pieces[input.Piece];
+            if (piece.Previous != TRACK_GRAPH_PIECE_NULL)
+            {
+                const auto& previous = graph->Pieces[piece.Previous];
+                auto tileElement = track_graph_get_element(*graph, rideIndex, previous, piece.PreviousEnd);
+                if (tileElement != nullptr)
+                {
+                    outTrackBeginEnd->begin_x = piece.PreviousBegin.x;
+                    outTrackBeginEnd->begin_y = piece.PreviousBegin.y;
+                    outTrackBeginEnd->begin_z = piece.PreviousBegin.z;
+                    outTrackBeginEnd->begin_direction = piece.PreviousBeginDirection;
+                    outTrackBeginEnd->begin_element = tileElement;
+                    outTrackBeginEnd->end_x = piece.PreviousEnd.Tile.x;
+                    outTrackBeginEnd->end_y = piece.PreviousEnd.Tile.y;
+                    outTrackBeginEnd->end_direction = piece.PreviousEndDirection;
+                    if (outPiece != nullptr)
+                        *outPiece = piece.Previous;
+                    return true;
+                }
+            }
+        }
+    }
+
+    if (outPiece != nullptr)
+        *outPiece = TRACK_GRAPH_PIECE_NULL;
+    return track_block_get_previous(input.Element, outTrackBeginEnd);
+}
@@ -0,0 +1,57 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "../world/Map.h"
+#include "RideTypes.h"
+
+#include <limits>
+
+struct track_begin_end;
+
+/*
+ * The track graph is a compiled form of each ride's track so that moving vehicles can go from one piece to the next
+ * without working out where the next piece is and searching its tile for it. Each ride has a flat array of pieces whose
+ * next and previous links are indices into that same array. It is built by walking the circuit out from the ride's
+ * stations with the regular track functions. Ghost elements are never part of it.
+ *
+ * Placing or removing track, demolishing the ride and changing its type mark the graph of that ride out of date, it is
+ * rebuilt the next time one of its pieces is looked up. Other changes to the map only move elements around within their
+ * tile, so every piece remembers the slot its elements were found in and only searches the tile again when an element
+ * is no longer in that slot.
+ *
+ * Pieces that cannot be reached from a station have no index. Cursors for them, and links the graph does not have, go
+ * through the regular functions so callers see exactly the same outputs.
+ */
+
+constexpr uint32_t TRACK_GRAPH_PIECE_NULL = std::numeric_limits<uint32_t>::max();
+
+/**
+ * A track element together with the index of its piece in the ride's graph. Indices change when the graph is rebuilt,
+ * so cursors must not be kept beyond the next call to track_graph_get_piece.
+ */
+struct TrackGraphCursor
+{
+    CoordsXYE Element = {};
+    uint32_t Piece = TRACK_GRAPH_PIECE_NULL;
+};
+
+void track_graph_invalidate();
+void track_graph_invalidate_ride(ride_id_t rideIndex);
+
+/** Equivalent of map_get_track_element_at_of_type_seq(trackPos, trackType, 0) for a piece of the given ride. */
+TrackGraphCursor track_graph_get_piece(ride_id_t rideIndex, const CoordsXYZ& trackPos, int32_t trackType);
+
+/** Equivalent of track_block_get_next, input and output may be the same cursor. */
+bool track_graph_get_next(const TrackGraphCursor& input, TrackGraphCursor* output, int32_t* z, int32_t* direction);
+
+/** Equivalent of track_block_get_previous, outPiece receives the index of the piece begin_element belongs to. */
+bool track_graph_get_previous(const TrackGraphCursor& input, track_begin_end* outTrackBeginEnd, uint32_t* outPiece);
@@ -27,6 +27,8 @@
 #include "TrackData.h"
 #include "TrackDesign.h"
 
+#include <memory>
+
 // clang-format off
 /* rct2: 0x007667AC */
 static constexpr TileCoordsXY EntranceOffsetEdgeNE[] = {
@@ -2129,6 +2131,57 @@ void track_paint_util_left_corkscrew_up_supports(paint_session* session, uint8_t
     }
 }
 
+struct RideTrackPaintFunctions
+{
+    bool DependsOnDirection = false;
+    TRACK_PAINT_FUNCTION Functions[TRACK_ELEM_COUNT] = {};
+};
+
+/**
+ * Calls the paint function getter of each ride type once for every track type and direction. None of the current
+ * getters look at the direction, a ride type with one that does is marked so the getter is still called when painting.
+ */
+static std::unique_ptr<RideTrackPaintFunctions[]> CreateTrackPaintFunctionTable()
+{
+    auto table = std::make_unique<RideTrackPaintFunctions[]>(RIDE_TYPE_COUNT);
+    for (size_t rideType = 0; rideType < RIDE_TYPE_COUNT; rideType++)
+    {
+        auto getter = RideTypeDescriptors[rideType].TrackPaintFunction;
+        if (getter == nullptr)
+            continue;
+
+        auto& rideFunctions = table[rideType];
+        for (int32_t trackType = 0; trackType < TRACK_ELEM_COUNT; trackType++)
+        {
+            auto paintFunction = getter(trackType, 0);
+            for (int32_t direction = 1; direction < NumOrthogonalDirections; direction++)
+            {
+                if (getter(trackType, direction) != paintFunction)
+                {
+                    rideFunctions.DependsOnDirection = true;
+                }
+            }
+            rideFunctions.Functions[trackType] = paintFunction;
+        }
+    }
+    return table;
+}
+
+static TRACK_PAINT_FUNCTION track_paint_get_function(uint8_t rideType, int32_t trackType, uint8_t direction)
+{
+    static const auto table = CreateTrackPaintFunctionTable();
+    if (rideType >= RIDE_TYPE_COUNT)
+        return nullptr;
+
+    const auto& rideFunctions = table[rideType];
+    if (rideFunctions.DependsOnDirection || trackType >= TRACK_ELEM_COUNT)
+    {
+        auto getter = RideTypeDescriptors[rideType].TrackPaintFunction;
+        return getter != nullptr ? getter(trackType, direction) : nullptr;
+    }
+    return rideFunctions.Functions[trackType];
+}
+
 /**
  *
  *  rct2: 0x006C4794
@@ -2190,14 +2243,10 @@ void track_paint(paint_session* session, uint8_t direction, int32_t height, cons
             session->TrackColours[SCHEME_3] = ghost_id;
         }
 
-        TRACK_PAINT_FUNCTION_GETTER paintFunctionGetter = RideTypeDescriptors[ride->type].TrackPaintFunction;
-        if (paintFunctionGetter != nullptr)
+        TRACK_PAINT_FUNCTION paintFunction = track_paint_get_function(ride->type, trackType, direction);
+        if (paintFunction != nullptr)
         {
-            TRACK_PAINT_FUNCTION paintFunction = paintFunctionGetter(trackType, direction);
-            if (paintFunction != nullptr)
-            {
-                paintFunction(session, rideIndex, trackSequence, direction, height, tileElement);
-            }
+            paintFunction(session, rideIndex, trackSequence, direction, height, tileElement);
         }
     }
 }
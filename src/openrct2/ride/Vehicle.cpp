@@ -40,11 +40,14 @@
 #include "Station.h"
 #include "Track.h"
 #include "TrackData.h"
+#include "TrackGraph.h"
 #include "VehicleData.h"
 #include "VehicleSubpositionData.h"
 
 #include <algorithm>
+#include <array>
 #include <iterator>
+#include <memory>
 
 static bool vehicle_boat_is_location_accessible(const CoordsXYZ& location);
 static bool vehicle_update_motion_collision_detection(
@@ -57,20 +60,6 @@ constexpr int16_t VEHICLE_MAX_SPIN_SPEED_WATER_RIDE = 512;
 constexpr int16_t VEHICLE_MIN_SPIN_SPEED_WATER_RIDE = -VEHICLE_MAX_SPIN_SPEED_WATER_RIDE;
 constexpr int16_t VEHICLE_STOPPING_SPIN_SPEED = 600;
 
-Vehicle* gCurrentVehicle;
-
-static uint8_t _vehicleBreakdown;
-StationIndex _vehicleStationIndex;
-uint32_t _vehicleMotionTrackFlags;
-int32_t _vehicleVelocityF64E08;
-int32_t _vehicleVelocityF64E0C;
-int32_t _vehicleUnkF64E10;
-uint8_t _vehicleVAngleEndF64E36;
-uint8_t _vehicleBankEndF64E37;
-uint8_t _vehicleF64E2C;
-Vehicle* _vehicleFrontVehicle;
-CoordsXYZ unk_F64E20;
-
 // clang-format off
 static constexpr const SoundId byte_9A3A14[] = { SoundId::Scream8, SoundId::Scream1 };
 static constexpr const SoundId byte_9A3A16[] = { SoundId::Scream1, SoundId::Scream6 };
@@ -732,64 +721,15 @@ template<> bool SpriteBase::Is<Vehicle>() const
     return sprite_identifier == SPRITE_IDENTIFIER_VEHICLE;
 }
 
-static bool vehicle_move_info_valid(int32_t trackSubposition, int32_t typeAndDirection, int32_t offset)
-{
-    if (trackSubposition >= static_cast<int32_t>(std::size(gTrackVehicleInfo)))
-    {
-        return false;
-    }
-    int32_t size = 0;
-    switch (trackSubposition)
-    {
-        case VEHICLE_TRACK_SUBPOSITION_0:
-            size = 1024;
-            break;
-        case VEHICLE_TRACK_SUBPOSITION_CHAIRLIFT_GOING_OUT:
-            size = 692;
-            break;
-        case VEHICLE_TRACK_SUBPOSITION_CHAIRLIFT_GOING_BACK:
-        case VEHICLE_TRACK_SUBPOSITION_CHAIRLIFT_END_BULLWHEEL:
-        case VEHICLE_TRACK_SUBPOSITION_CHAIRLIFT_START_BULLWHEEL:
-            size = 404;
-            break;
-        case VEHICLE_TRACK_SUBPOSITION_GO_KARTS_LEFT_LANE:
-        case VEHICLE_TRACK_SUBPOSITION_GO_KARTS_RIGHT_LANE:
-        case VEHICLE_TRACK_SUBPOSITION_GO_KARTS_MOVING_TO_RIGHT_LANE:
-        case VEHICLE_TRACK_SUBPOSITION_GO_KARTS_MOVING_TO_LEFT_LANE:
-            size = 208;
-            break;
-        case VEHICLE_TRACK_SUBPOSITION_MINI_GOLF_PATH_A_9: // VEHICLE_TRACK_SUBPOSITION_MINI_GOLF_START_9
-        case VEHICLE_TRACK_SUBPOSITION_MINI_GOLF_BALL_PATH_A_10:
-        case VEHICLE_TRACK_SUBPOSITION_MINI_GOLF_PATH_B_11:
-        case VEHICLE_TRACK_SUBPOSITION_MINI_GOLF_BALL_PATH_B_12:
-        case VEHICLE_TRACK_SUBPOSITION_MINI_GOLF_PATH_C_13:
-        case VEHICLE_TRACK_SUBPOSITION_MINI_GOLF_BALL_PATH_C_14:
-            size = 824;
-            break;
-        case VEHICLE_TRACK_SUBPOSITION_REVERSER_RC_FRONT_BOGIE:
-        case VEHICLE_TRACK_SUBPOSITION_REVERSER_RC_REAR_BOGIE:
-            size = 868;
-            break;
-    }
-    if (typeAndDirection >= size)
-    {
-        return false;
-    }
-    if (offset >= gTrackVehicleInfo[trackSubposition][typeAndDirection]->size)
-    {
-        return false;
-    }
-    return true;
-}
-
 static const rct_vehicle_info* vehicle_get_move_info(int32_t trackSubposition, int32_t typeAndDirection, int32_t offset)
 {
-    if (!vehicle_move_info_valid(trackSubposition, typeAndDirection, offset))
+    auto list = track_vehicle_info_get_list(trackSubposition, typeAndDirection);
+    if (list == nullptr || offset < 0 || offset >= list->size)
     {
         static constexpr const rct_vehicle_info zero = {};
         return &zero;
     }
-    return &gTrackVehicleInfo[trackSubposition][typeAndDirection]->info[offset];
+    return &list->info[offset];
 }
 
 const rct_vehicle_info* Vehicle::GetMoveInfo() const
@@ -799,11 +739,12 @@ const rct_vehicle_info* Vehicle::GetMoveInfo() const
 
 static uint16_t vehicle_get_move_info_size(int32_t trackSubposition, int32_t typeAndDirection)
 {
-    if (!vehicle_move_info_valid(trackSubposition, typeAndDirection, 0))
+    auto list = track_vehicle_info_get_list(trackSubposition, typeAndDirection);
+    if (list == nullptr)
     {
         return 0;
     }
-    return gTrackVehicleInfo[trackSubposition][typeAndDirection]->size;
+    return list->size;
 }
 
 uint16_t Vehicle::GetTrackProgress() const
@@ -1411,7 +1352,8 @@ void vehicle_update_all()
 
     for (auto vehicle : EntityList<Vehicle>(SPRITE_LIST_TRAIN_HEAD))
     {
-        vehicle->Update();
+        VehicleMotionContext motion;
+        vehicle->Update(motion);
     }
 }
 
@@ -1995,12 +1937,12 @@ static SoundIdVolume sub_6D7AC0(SoundId currentSoundId, uint8_t currentVolume, S
  *
  *  rct2: 0x006D77F2
  */
-void Vehicle::Update()
+void Vehicle::Update(VehicleMotionContext& motion)
 {
     // The cable lift uses the ride type of NULL
     if (ride_subtype == RIDE_TYPE_NULL)
     {
-        CableLiftUpdate();
+        CableLiftUpdate(motion);
         return;
     }
 
@@ -2015,10 +1957,10 @@ void Vehicle::Update()
     if (HasUpdateFlag(VEHICLE_UPDATE_FLAG_TESTING))
         UpdateMeasurements();
 
-    _vehicleBreakdown = 255;
+    motion.Breakdown = 255;
     if (curRide->lifecycle_flags & (RIDE_LIFECYCLE_BREAKDOWN_PENDING | RIDE_LIFECYCLE_BROKEN_DOWN))
     {
-        _vehicleBreakdown = curRide->breakdown_reason_pending;
+        motion.Breakdown = curRide->breakdown_reason_pending;
         auto vehicleEntry = &rideEntry->vehicles[vehicle_type];
         if ((vehicleEntry->flags & VEHICLE_ENTRY_FLAG_POWERED) && curRide->breakdown_reason_pending == BREAKDOWN_SAFETY_CUT_OUT)
         {
@@ -2032,59 +1974,59 @@ void Vehicle::Update()
     switch (status)
     {
         case VEHICLE_STATUS_MOVING_TO_END_OF_STATION:
-            UpdateMovingToEndOfStation();
+            UpdateMovingToEndOfStation(motion);
             break;
         case VEHICLE_STATUS_WAITING_FOR_PASSENGERS:
             UpdateWaitingForPassengers();
             break;
         case VEHICLE_STATUS_WAITING_TO_DEPART:
-            UpdateWaitingToDepart();
+            UpdateWaitingToDepart(motion);
             break;
         case VEHICLE_STATUS_CRASHING:
         case VEHICLE_STATUS_CRASHED:
             UpdateCrash();
             break;
         case VEHICLE_STATUS_TRAVELLING_DODGEMS:
-            UpdateDodgemsMode();
+            UpdateDodgemsMode(motion);
             break;
         case VEHICLE_STATUS_SWINGING:
             UpdateSwinging();
             break;
         case VEHICLE_STATUS_SIMULATOR_OPERATING:
-            UpdateSimulatorOperating();
+            UpdateSimulatorOperating(motion);
             break;
         case VEHICLE_STATUS_TOP_SPIN_OPERATING:
-            UpdateTopSpinOperating();
+            UpdateTopSpinOperating(motion);
             break;
         case VEHICLE_STATUS_FERRIS_WHEEL_ROTATING:
-            UpdateFerrisWheelRotating();
+            UpdateFerrisWheelRotating(motion);
             break;
         case VEHICLE_STATUS_SPACE_RINGS_OPERATING:
-            UpdateSpaceRingsOperating();
+            UpdateSpaceRingsOperating(motion);
             break;
         case VEHICLE_STATUS_HAUNTED_HOUSE_OPERATING:
-            UpdateHauntedHouseOperating();
+            UpdateHauntedHouseOperating(motion);
             break;
         case VEHICLE_STATUS_CROOKED_HOUSE_OPERATING:
-            UpdateCrookedHouseOperating();
+            UpdateCrookedHouseOperating(motion);
             break;
         case VEHICLE_STATUS_ROTATING:
-            UpdateRotating();
+            UpdateRotating(motion);
             break;
         case VEHICLE_STATUS_DEPARTING:
-            UpdateDeparting();
+            UpdateDeparting(motion);
             break;
         case VEHICLE_STATUS_TRAVELLING:
-            UpdateTravelling();
+            UpdateTravelling(motion);
             break;
         case VEHICLE_STATUS_TRAVELLING_CABLE_LIFT:
-            UpdateTravellingCableLift();
+            UpdateTravellingCableLift(motion);
             break;
         case VEHICLE_STATUS_TRAVELLING_BOAT:
-            UpdateTravellingBoat();
+            UpdateTravellingBoat(motion);
             break;
         case VEHICLE_STATUS_ARRIVING:
-            UpdateArriving();
+            UpdateArriving(motion);
             break;
         case VEHICLE_STATUS_UNLOADING_PASSENGERS:
             UpdateUnloadingPassengers();
@@ -2093,10 +2035,10 @@ void Vehicle::Update()
             UpdateWaitingForCableLift();
             break;
         case VEHICLE_STATUS_SHOWING_FILM:
-            UpdateShowingFilm();
+            UpdateShowingFilm(motion);
             break;
         case VEHICLE_STATUS_DOING_CIRCUS_SHOW:
-            UpdateDoingCircusShow();
+            UpdateDoingCircusShow(motion);
         default:
             break;
     }
@@ -2108,7 +2050,7 @@ void Vehicle::Update()
  *
  *  rct2: 0x006D7BCC
  */
-void Vehicle::UpdateMovingToEndOfStation()
+void Vehicle::UpdateMovingToEndOfStation(VehicleMotionContext& motion)
 {
     auto curRide = get_ride(ride);
     if (curRide == nullptr)
@@ -2131,7 +2073,7 @@ void Vehicle::UpdateMovingToEndOfStation()
                 velocity -= velocity / 16;
                 acceleration = 0;
             }
-            curFlags = UpdateTrackMotion(&station);
+            curFlags = UpdateTrackMotion(motion, &station);
             if (!(curFlags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_5))
                 break;
             [[fallthrough]];
@@ -2180,7 +2122,7 @@ void Vehicle::UpdateMovingToEndOfStation()
                 acceleration = 0;
             }
 
-            curFlags = UpdateTrackMotion(&station);
+            curFlags = UpdateTrackMotion(motion, &station);
 
             if (curFlags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_1)
             {
@@ -2468,7 +2410,7 @@ void Vehicle::UpdateWaitingForPassengers()
  *
  *  rct2: 0x006D91BF
  */
-void Vehicle::UpdateDodgemsMode()
+void Vehicle::UpdateDodgemsMode(VehicleMotionContext& motion)
 {
     auto curRide = get_ride(ride);
     if (curRide == nullptr)
@@ -2488,7 +2430,7 @@ void Vehicle::UpdateDodgemsMode()
         Invalidate();
     }
 
-    UpdateMotionDodgems();
+    UpdateMotionDodgems(motion);
 
     // Update the length of time vehicle has been in dodgems mode
     if (sub_state++ == 0xFF)
@@ -2511,7 +2453,7 @@ void Vehicle::UpdateDodgemsMode()
  *
  *  rct2: 0x006D80BE
  */
-void Vehicle::UpdateWaitingToDepart()
+void Vehicle::UpdateWaitingToDepart(VehicleMotionContext& motion)
 {
     auto curRide = get_ride(ride);
     if (curRide == nullptr)
@@ -2620,7 +2562,7 @@ void Vehicle::UpdateWaitingToDepart()
             // the vehicle has been ridden.
             SetState(VEHICLE_STATUS_TRAVELLING_DODGEMS);
             var_CE = 0;
-            UpdateDodgemsMode();
+            UpdateDodgemsMode(motion);
             break;
         case RIDE_MODE_SWING:
             SetState(VEHICLE_STATUS_SWINGING);
@@ -2632,17 +2574,17 @@ void Vehicle::UpdateWaitingToDepart()
             SetState(VEHICLE_STATUS_ROTATING);
             var_CE = 0;
             current_time = -1;
-            UpdateRotating();
+            UpdateRotating(motion);
             break;
         case RIDE_MODE_FILM_AVENGING_AVIATORS:
             SetState(VEHICLE_STATUS_SIMULATOR_OPERATING);
             current_time = -1;
-            UpdateSimulatorOperating();
+            UpdateSimulatorOperating(motion);
             break;
         case RIDE_MODE_FILM_THRILL_RIDERS:
             SetState(VEHICLE_STATUS_SIMULATOR_OPERATING, 1);
             current_time = -1;
-            UpdateSimulatorOperating();
+            UpdateSimulatorOperating(motion);
             break;
         case RIDE_MODE_BEGINNERS:
         case RIDE_MODE_INTENSE:
@@ -2664,7 +2606,7 @@ void Vehicle::UpdateWaitingToDepart()
             current_time = -1;
             vehicle_sprite_type = 0;
             bank_rotation = 0;
-            UpdateTopSpinOperating();
+            UpdateTopSpinOperating(motion);
             break;
         case RIDE_MODE_FORWARD_ROTATION:
         case RIDE_MODE_BACKWARD_ROTATION:
@@ -2672,7 +2614,7 @@ void Vehicle::UpdateWaitingToDepart()
             var_CE = 0;
             ferris_wheel_var_0 = 8;
             ferris_wheel_var_1 = 8;
-            UpdateFerrisWheelRotating();
+            UpdateFerrisWheelRotating(motion);
             break;
         case RIDE_MODE_3D_FILM_MOUSE_TAILS:
         case RIDE_MODE_3D_FILM_STORM_CHASERS:
@@ -2691,30 +2633,30 @@ void Vehicle::UpdateWaitingToDepart()
                     break;
             }
             current_time = -1;
-            UpdateShowingFilm();
+            UpdateShowingFilm(motion);
             break;
         case RIDE_MODE_CIRCUS_SHOW:
             SetState(VEHICLE_STATUS_DOING_CIRCUS_SHOW);
             current_time = -1;
-            UpdateDoingCircusShow();
+            UpdateDoingCircusShow(motion);
             break;
         case RIDE_MODE_SPACE_RINGS:
             SetState(VEHICLE_STATUS_SPACE_RINGS_OPERATING);
             vehicle_sprite_type = 0;
             current_time = -1;
-            UpdateSpaceRingsOperating();
+            UpdateSpaceRingsOperating(motion);
             break;
         case RIDE_MODE_HAUNTED_HOUSE:
             SetState(VEHICLE_STATUS_HAUNTED_HOUSE_OPERATING);
             vehicle_sprite_type = 0;
             current_time = -1;
-            UpdateHauntedHouseOperating();
+            UpdateHauntedHouseOperating(motion);
             break;
         case RIDE_MODE_CROOKED_HOUSE:
             SetState(VEHICLE_STATUS_CROOKED_HOUSE_OPERATING);
             vehicle_sprite_type = 0;
             current_time = -1;
-            UpdateCrookedHouseOperating();
+            UpdateCrookedHouseOperating(motion);
             break;
         default:
             SetState(status);
@@ -3185,7 +3127,7 @@ bool Vehicle::CurrentTowerElementIsTop()
  *
  *  rct2: 0x006D986C
  */
-void Vehicle::UpdateTravellingBoatHireSetup()
+void Vehicle::UpdateTravellingBoatHireSetup(VehicleMotionContext& motion)
 {
     var_34 = sprite_direction;
     TrackLocation.x = x;
@@ -3201,14 +3143,14 @@ void Vehicle::UpdateTravellingBoatHireSetup()
     SetState(VEHICLE_STATUS_TRAVELLING_BOAT);
     remaining_distance += 27924;
 
-    UpdateTravellingBoat();
+    UpdateTravellingBoat(motion);
 }
 
 /**
  *
  *  rct2: 0x006D982F
  */
-void Vehicle::UpdateDepartingBoatHire()
+void Vehicle::UpdateDepartingBoatHire(VehicleMotionContext& motion)
 {
     lost_time_out = 0;
 
@@ -3220,14 +3162,14 @@ void Vehicle::UpdateDepartingBoatHire()
     uint8_t waitingTime = std::max(curRide->min_waiting_time, static_cast<uint8_t>(3));
     waitingTime = std::min(waitingTime, static_cast<uint8_t>(127));
     curRide->stations[current_station].Depart |= waitingTime;
-    UpdateTravellingBoatHireSetup();
+    UpdateTravellingBoatHireSetup(motion);
 }
 
 /**
  *
  *  rct2: 0x006D845B
  */
-void Vehicle::UpdateDeparting()
+void Vehicle::UpdateDeparting(VehicleMotionContext& motion)
 {
     auto curRide = get_ride(ride);
     if (curRide == nullptr)
@@ -3338,7 +3280,7 @@ void Vehicle::UpdateDeparting()
             break;
     }
 
-    uint32_t curFlags = UpdateTrackMotion(nullptr);
+    uint32_t curFlags = UpdateTrackMotion(motion, nullptr);
 
     if (curFlags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_8)
     {
@@ -3354,7 +3296,7 @@ void Vehicle::UpdateDeparting()
     {
         if (curRide->mode == RIDE_MODE_BOAT_HIRE)
         {
-            UpdateDepartingBoatHire();
+            UpdateDepartingBoatHire(motion);
             return;
         }
         else if (curRide->mode == RIDE_MODE_REVERSE_INCLINE_LAUNCHED_SHUTTLE)
@@ -3384,7 +3326,7 @@ void Vehicle::UpdateDeparting()
                 acceleration = 15539;
                 if (velocity != 0)
                 {
-                    if (_vehicleBreakdown == BREAKDOWN_SAFETY_CUT_OUT)
+                    if (motion.Breakdown == BREAKDOWN_SAFETY_CUT_OUT)
                     {
                         SetUpdateFlag(VEHICLE_UPDATE_FLAG_ZERO_VELOCITY);
                         ClearUpdateFlag(VEHICLE_UPDATE_FLAG_1);
@@ -3402,7 +3344,7 @@ void Vehicle::UpdateDeparting()
                 acceleration = -15539;
                 if (velocity != 0)
                 {
-                    if (_vehicleBreakdown == BREAKDOWN_SAFETY_CUT_OUT)
+                    if (motion.Breakdown == BREAKDOWN_SAFETY_CUT_OUT)
                     {
                         SetUpdateFlag(VEHICLE_UPDATE_FLAG_ZERO_VELOCITY);
                         ClearUpdateFlag(VEHICLE_UPDATE_FLAG_1);
@@ -3429,7 +3371,7 @@ void Vehicle::UpdateDeparting()
 
         if (shouldLaunch)
         {
-            if (!(curFlags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_3) || _vehicleStationIndex != current_station)
+            if (!(curFlags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_3) || motion.CurrentStation != current_station)
             {
                 FinishDeparting();
                 return;
@@ -3716,12 +3658,12 @@ void Vehicle::UpdateCrashSetup()
  *
  *  rct2: 0x006D8937
  */
-void Vehicle::UpdateTravelling()
+void Vehicle::UpdateTravelling(VehicleMotionContext& motion)
 {
     CheckIfMissing();
 
     auto curRide = get_ride(ride);
-    if (curRide == nullptr || (_vehicleBreakdown == 0 && curRide->mode == RIDE_MODE_ROTATING_LIFT))
+    if (curRide == nullptr || (motion.Breakdown == 0 && curRide->mode == RIDE_MODE_ROTATING_LIFT))
         return;
 
     if (sub_state == 2)
@@ -3742,7 +3684,7 @@ void Vehicle::UpdateTravelling()
         return;
     }
 
-    uint32_t curFlags = UpdateTrackMotion(nullptr);
+    uint32_t curFlags = UpdateTrackMotion(motion, nullptr);
 
     bool skipCheck = false;
     if (curFlags & (VEHICLE_UPDATE_MOTION_TRACK_FLAG_8 | VEHICLE_UPDATE_MOTION_TRACK_FLAG_9)
@@ -3780,7 +3722,7 @@ void Vehicle::UpdateTravelling()
             }
             else if (curRide->mode == RIDE_MODE_BOAT_HIRE)
             {
-                UpdateTravellingBoatHireSetup();
+                UpdateTravellingBoatHireSetup(motion);
                 return;
             }
             else if (curRide->mode == RIDE_MODE_SHUTTLE)
@@ -3840,7 +3782,7 @@ void Vehicle::UpdateTravelling()
                     {
                         acceleration = -15539;
 
-                        if (_vehicleBreakdown == 0)
+                        if (motion.Breakdown == 0)
                         {
                             sound2_flags &= ~VEHICLE_SOUND2_FLAGS_LIFT_HILL;
                             SetUpdateFlag(VEHICLE_UPDATE_FLAG_ZERO_VELOCITY);
@@ -3857,7 +3799,7 @@ void Vehicle::UpdateTravelling()
                 acceleration = 15539;
                 if (velocity != 0)
                 {
-                    if (_vehicleBreakdown == 0)
+                    if (motion.Breakdown == 0)
                     {
                         SetUpdateFlag(VEHICLE_UPDATE_FLAG_ZERO_VELOCITY);
                         sound2_flags &= ~VEHICLE_SOUND2_FLAGS_LIFT_HILL;
@@ -3883,7 +3825,7 @@ void Vehicle::UpdateTravelling()
         return;
 
     SetState(VEHICLE_STATUS_ARRIVING);
-    current_station = _vehicleStationIndex;
+    current_station = motion.CurrentStation;
     var_C0 = 0;
     if (velocity < 0)
         sub_state = 1;
@@ -3893,7 +3835,7 @@ void Vehicle::UpdateTravelling()
  *
  *  rct2: 0x006D8C36
  */
-void Vehicle::UpdateArriving()
+void Vehicle::UpdateArriving(VehicleMotionContext& motion)
 {
     auto curRide = get_ride(ride);
     if (curRide == nullptr)
@@ -4018,7 +3960,7 @@ void Vehicle::UpdateArriving()
 
     uint32_t curFlags;
 loc_6D8E36:
-    curFlags = UpdateTrackMotion(nullptr);
+    curFlags = UpdateTrackMotion(motion, nullptr);
     if (curFlags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_COLLISION && unkF64E35 == 0)
     {
         UpdateCollisionSetup();
@@ -4214,7 +4156,7 @@ void Vehicle::UpdateWaitingForCableLift()
  *
  *  rct2: 0x006D9D21
  */
-void Vehicle::UpdateTravellingCableLift()
+void Vehicle::UpdateTravellingCableLift(VehicleMotionContext& motion)
 {
     auto curRide = get_ride(ride);
     if (curRide == nullptr)
@@ -4266,7 +4208,7 @@ void Vehicle::UpdateTravellingCableLift()
     {
         acceleration = 4398;
     }
-    int32_t curFlags = UpdateTrackMotion(nullptr);
+    int32_t curFlags = UpdateTrackMotion(motion, nullptr);
 
     if (curFlags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_11)
     {
@@ -4278,7 +4220,7 @@ void Vehicle::UpdateTravellingCableLift()
     if (sub_state == 2)
         return;
 
-    if (curFlags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_3 && current_station == _vehicleStationIndex)
+    if (curFlags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_3 && current_station == motion.CurrentStation)
         return;
 
     sub_state = 2;
@@ -4303,13 +4245,14 @@ void Vehicle::UpdateTravellingCableLift()
  *
  *  rct2: 0x006D9820
  */
-void Vehicle::UpdateTravellingBoat()
+void Vehicle::UpdateTravellingBoat(VehicleMotionContext& motion)
 {
     CheckIfMissing();
-    UpdateMotionBoatHire();
+    UpdateMotionBoatHire(motion);
 }
 
-void Vehicle::TryReconnectBoatToTrack(const CoordsXY& currentBoatLocation, const CoordsXY& trackCoords)
+void Vehicle::TryReconnectBoatToTrack(
+    VehicleMotionContext& motion, const CoordsXY& currentBoatLocation, const CoordsXY& trackCoords)
 {
     remaining_distance = 0;
     if (!vehicle_update_motion_collision_detection(this, currentBoatLocation.x, currentBoatLocation.y, z, nullptr))
@@ -4328,8 +4271,8 @@ void Vehicle::TryReconnectBoatToTrack(const CoordsXY& currentBoatLocation, const
 
         track_progress = 0;
         SetState(VEHICLE_STATUS_TRAVELLING, sub_state);
-        unk_F64E20.x = currentBoatLocation.x;
-        unk_F64E20.y = currentBoatLocation.y;
+        motion.UnkF64E20.x = currentBoatLocation.x;
+        motion.UnkF64E20.y = currentBoatLocation.y;
     }
 }
 
@@ -4337,12 +4280,12 @@ void Vehicle::TryReconnectBoatToTrack(const CoordsXY& currentBoatLocation, const
  *
  *  rct2: 0x006DA717
  */
-void Vehicle::UpdateMotionBoatHire()
+void Vehicle::UpdateMotionBoatHire(VehicleMotionContext& motion)
 {
-    _vehicleMotionTrackFlags = 0;
+    motion.MotionTrackFlags = 0;
     velocity += acceleration;
-    _vehicleVelocityF64E08 = velocity;
-    _vehicleVelocityF64E0C = (velocity >> 10) * 42;
+    motion.VelocityF64E08 = velocity;
+    motion.VelocityF64E0C = (velocity >> 10) * 42;
 
     auto vehicleEntry = Entry();
     if (vehicleEntry == nullptr)
@@ -4351,18 +4294,18 @@ void Vehicle::UpdateMotionBoatHire()
     }
     if (vehicleEntry->flags & (VEHICLE_ENTRY_FLAG_VEHICLE_ANIMATION | VEHICLE_ENTRY_FLAG_RIDER_ANIMATION))
     {
-        UpdateAdditionalAnimation();
+        UpdateAdditionalAnimation(motion);
     }
 
-    _vehicleUnkF64E10 = 1;
+    motion.UnkF64E10 = 1;
     acceleration = 0;
-    remaining_distance += _vehicleVelocityF64E0C;
+    remaining_distance += motion.VelocityF64E0C;
     if (remaining_distance >= 0x368A)
     {
         sound2_flags &= ~VEHICLE_SOUND2_FLAGS_LIFT_HILL;
-        unk_F64E20.x = x;
-        unk_F64E20.y = y;
-        unk_F64E20.z = z;
+        motion.UnkF64E20.x = x;
+        motion.UnkF64E20.y = y;
+        motion.UnkF64E20.z = z;
         Invalidate();
 
         for (;;)
@@ -4530,18 +4473,18 @@ void Vehicle::UpdateMotionBoatHire()
                         uint16_t tilePart = curY % COORDS_XY_STEP;
                         if (tilePart == COORDS_XY_HALF_TILE)
                         {
-                            TryReconnectBoatToTrack({ curX, curY }, flooredLocation);
+                            TryReconnectBoatToTrack(motion, { curX, curY }, flooredLocation);
                             break;
                         }
                         if (tilePart <= COORDS_XY_HALF_TILE)
                         {
-                            curX = unk_F64E20.x;
-                            curY = unk_F64E20.y + 1;
+                            curX = motion.UnkF64E20.x;
+                            curY = motion.UnkF64E20.y + 1;
                         }
                         else
                         {
-                            curX = unk_F64E20.x;
-                            curY = unk_F64E20.y - 1;
+                            curX = motion.UnkF64E20.x;
+                            curY = motion.UnkF64E20.y - 1;
                         }
                     }
                     else
@@ -4550,18 +4493,18 @@ void Vehicle::UpdateMotionBoatHire()
                         uint16_t tilePart = curX % COORDS_XY_STEP;
                         if (tilePart == COORDS_XY_HALF_TILE)
                         {
-                            TryReconnectBoatToTrack({ curX, curY }, flooredLocation);
+                            TryReconnectBoatToTrack(motion, { curX, curY }, flooredLocation);
                             break;
                         }
                         if (tilePart <= COORDS_XY_HALF_TILE)
                         {
-                            curX = unk_F64E20.x + 1;
-                            curY = unk_F64E20.y;
+                            curX = motion.UnkF64E20.x + 1;
+                            curY = motion.UnkF64E20.y;
                         }
                         else
                         {
-                            curX = unk_F64E20.x - 1;
-                            curY = unk_F64E20.y;
+                            curX = motion.UnkF64E20.x - 1;
+                            curY = motion.UnkF64E20.y;
                         }
                     }
 
@@ -4569,8 +4512,8 @@ void Vehicle::UpdateMotionBoatHire()
                     remaining_distance = 0;
                     if (!vehicle_update_motion_collision_detection(this, curX, curY, z, nullptr))
                     {
-                        unk_F64E20.x = curX;
-                        unk_F64E20.y = curY;
+                        motion.UnkF64E20.x = curX;
+                        motion.UnkF64E20.y = curY;
                     }
                     break;
                 }
@@ -4578,16 +4521,16 @@ void Vehicle::UpdateMotionBoatHire()
             }
 
             remaining_distance -= Unk9A36C4[edi].distance;
-            unk_F64E20.x = curX;
-            unk_F64E20.y = curY;
+            motion.UnkF64E20.x = curX;
+            motion.UnkF64E20.y = curY;
             if (remaining_distance < 0x368A)
             {
                 break;
             }
-            _vehicleUnkF64E10++;
+            motion.UnkF64E10++;
         }
 
-        MoveTo(unk_F64E20);
+        MoveTo(motion.UnkF64E20);
         Invalidate();
     }
 
@@ -4620,8 +4563,8 @@ void Vehicle::UpdateMotionBoatHire()
         }
         acceleration = ecx;
     }
-    // eax = _vehicleMotionTrackFlags;
-    // ebx = _vehicleStationIndex;
+    // eax = motion.MotionTrackFlags;
+    // ebx = motion.CurrentStation;
 }
 
 /**
@@ -4807,9 +4750,9 @@ void Vehicle::UpdateSwinging()
  *
  *  rct2: 0x006D9413
  */
-void Vehicle::UpdateFerrisWheelRotating()
+void Vehicle::UpdateFerrisWheelRotating(VehicleMotionContext& motion)
 {
-    if (_vehicleBreakdown == 0)
+    if (motion.Breakdown == 0)
         return;
 
     auto curRide = get_ride(ride);
@@ -4899,9 +4842,9 @@ void Vehicle::UpdateFerrisWheelRotating()
  *
  *  rct2: 0x006D94F2
  */
-void Vehicle::UpdateSimulatorOperating()
+void Vehicle::UpdateSimulatorOperating(VehicleMotionContext& motion)
 {
-    if (_vehicleBreakdown == 0)
+    if (motion.Breakdown == 0)
         return;
 
     assert(current_time >= -1);
@@ -4925,9 +4868,9 @@ void Vehicle::UpdateSimulatorOperating()
  *
  *  rct2: 0x006D92FF
  */
-void Vehicle::UpdateRotating()
+void Vehicle::UpdateRotating(VehicleMotionContext& motion)
 {
-    if (_vehicleBreakdown == 0)
+    if (motion.Breakdown == 0)
         return;
 
     auto curRide = get_ride(ride);
@@ -4955,7 +4898,7 @@ void Vehicle::UpdateRotating()
     }
 
     int32_t time = current_time;
-    if (_vehicleBreakdown == BREAKDOWN_CONTROL_FAILURE)
+    if (motion.Breakdown == BREAKDOWN_CONTROL_FAILURE)
     {
         time += (curRide->breakdown_sound_modifier >> 6) + 1;
     }
@@ -4974,7 +4917,7 @@ void Vehicle::UpdateRotating()
 
     current_time = -1;
     var_CE++;
-    if (_vehicleBreakdown != BREAKDOWN_CONTROL_FAILURE)
+    if (motion.Breakdown != BREAKDOWN_CONTROL_FAILURE)
     {
         bool shouldStop = true;
         if (curRide->status != RIDE_STATUS_CLOSED)
@@ -4996,7 +4939,7 @@ void Vehicle::UpdateRotating()
                 return;
             }
             sub_state++;
-            UpdateRotating();
+            UpdateRotating(motion);
             return;
         }
     }
@@ -5009,16 +4952,16 @@ void Vehicle::UpdateRotating()
     }
 
     sub_state = 1;
-    UpdateRotating();
+    UpdateRotating(motion);
 }
 
 /**
  *
  *  rct2: 0x006D97CB
  */
-void Vehicle::UpdateSpaceRingsOperating()
+void Vehicle::UpdateSpaceRingsOperating(VehicleMotionContext& motion)
 {
-    if (_vehicleBreakdown == 0)
+    if (motion.Breakdown == 0)
         return;
 
     uint8_t spriteType = SpaceRingsTimeToSpriteMap[current_time + 1];
@@ -5042,9 +4985,9 @@ void Vehicle::UpdateSpaceRingsOperating()
  *
  *  rct2: 0x006D9641
  */
-void Vehicle::UpdateHauntedHouseOperating()
+void Vehicle::UpdateHauntedHouseOperating(VehicleMotionContext& motion)
 {
-    if (_vehicleBreakdown == 0)
+    if (motion.Breakdown == 0)
         return;
 
     if (vehicle_sprite_type != 0)
@@ -5096,9 +5039,9 @@ void Vehicle::UpdateHauntedHouseOperating()
  *
  *  rct2: 0x006d9781
  */
-void Vehicle::UpdateCrookedHouseOperating()
+void Vehicle::UpdateCrookedHouseOperating(VehicleMotionContext& motion)
 {
-    if (_vehicleBreakdown == 0)
+    if (motion.Breakdown == 0)
         return;
 
     // Originally used an array of size 1 at 0x009A0AC4 and passed the sub state into it.
@@ -5116,9 +5059,9 @@ void Vehicle::UpdateCrookedHouseOperating()
  *
  *  rct2: 0x006D9547
  */
-void Vehicle::UpdateTopSpinOperating()
+void Vehicle::UpdateTopSpinOperating(VehicleMotionContext& motion)
 {
-    if (_vehicleBreakdown == 0)
+    if (motion.Breakdown == 0)
         return;
 
     const top_spin_time_to_sprite_map* sprite_map = TopSpinTimeToSpriteMaps[sub_state];
@@ -5148,11 +5091,11 @@ void Vehicle::UpdateTopSpinOperating()
  *
  *  rct2: 0x006D95AD
  */
-void Vehicle::UpdateShowingFilm()
+void Vehicle::UpdateShowingFilm(VehicleMotionContext& motion)
 {
     int32_t currentTime, totalTime;
 
-    if (_vehicleBreakdown == 0)
+    if (motion.Breakdown == 0)
         return;
 
     totalTime = RideFilmLength[sub_state];
@@ -5172,9 +5115,9 @@ void Vehicle::UpdateShowingFilm()
  *
  *  rct2: 0x006D95F7
  */
-void Vehicle::UpdateDoingCircusShow()
+void Vehicle::UpdateDoingCircusShow(VehicleMotionContext& motion)
 {
-    if (_vehicleBreakdown == 0)
+    if (motion.Breakdown == 0)
         return;
 
     int32_t currentTime = current_time + 1;
@@ -5721,22 +5664,23 @@ produceScream:
     return scream_sound_id;
 }
 
+struct GForceFactors
+{
+    int32_t Vertical{};
+    int32_t Lateral{};
+};
+
 /**
- *
- *  rct2: 0x006D73D0
- * ax: verticalG
- * dx: lateralG
- * esi: vehicle
+ * Returns the factors used to add the effect of speed on the g-forces of a vehicle at the given position of a track
+ * piece, 0 means there is no effect.
  */
-GForces Vehicle::GetGForces() const
+static GForceFactors vehicle_get_g_force_factors(uint16_t trackType, uint16_t trackProgress)
 {
-    int32_t gForceVert = ((static_cast<int64_t>(0x280000)) * Unk9A37E4[vehicle_sprite_type]) >> 32;
-    gForceVert = ((static_cast<int64_t>(gForceVert)) * Unk9A39C4[bank_rotation]) >> 32;
     int32_t lateralFactor = 0, vertFactor = 0;
 
     // Note shr has meant some of the below functions cast a known negative number to
     // unsigned. Possibly an original bug but will be left implemented.
-    switch (GetTrackType())
+    switch (trackType)
     {
         case TRACK_ELEM_FLAT:
         case TRACK_ELEM_END_STATION:
@@ -5912,17 +5856,17 @@ GForces Vehicle::GetGForces() const
             break;
         case TRACK_ELEM_S_BEND_LEFT:
         case TRACK_ELEM_S_BEND_LEFT_COVERED:
-            lateralFactor = (track_progress < 48) ? 98 : -98;
+            lateralFactor = (trackProgress < 48) ? 98 : -98;
             // 6d75FF
             break;
         case TRACK_ELEM_S_BEND_RIGHT:
         case TRACK_ELEM_S_BEND_RIGHT_COVERED:
-            lateralFactor = (track_progress < 48) ? -98 : 98;
+            lateralFactor = (trackProgress < 48) ? -98 : 98;
             // 6d7608
             break;
         case TRACK_ELEM_LEFT_VERTICAL_LOOP:
         case TRACK_ELEM_RIGHT_VERTICAL_LOOP:
-            vertFactor = (abs(track_progress - 155) / 2) + 28;
+            vertFactor = (abs(trackProgress - 155) / 2) + 28;
             // 6d7690
             break;
         case TRACK_ELEM_LEFT_QUARTER_TURN_3_TILES:
@@ -5965,12 +5909,12 @@ GForces Vehicle::GetGForces() const
             break;
         case TRACK_ELEM_HALF_LOOP_UP:
         case TRACK_ELEM_FLYER_HALF_LOOP_UP:
-            vertFactor = ((static_cast<uint16_t>(-(track_progress - 155))) / 2) + 28;
+            vertFactor = ((static_cast<uint16_t>(-(trackProgress - 155))) / 2) + 28;
             // 6d763E
             break;
         case TRACK_ELEM_HALF_LOOP_DOWN:
         case TRACK_ELEM_FLYER_HALF_LOOP_DOWN:
-            vertFactor = (track_progress / 2) + 28;
+            vertFactor = (trackProgress / 2) + 28;
             // 6d7656
             break;
         case TRACK_ELEM_LEFT_CORKSCREW_UP:
@@ -6012,16 +5956,16 @@ GForces Vehicle::GetGForces() const
             break;
         case TRACK_ELEM_WATER_SPLASH:
             vertFactor = -150;
-            if (track_progress < 32)
+            if (trackProgress < 32)
                 break;
             vertFactor = 150;
-            if (track_progress < 64)
+            if (trackProgress < 64)
                 break;
             vertFactor = 0;
-            if (track_progress < 96)
+            if (trackProgress < 96)
                 break;
             vertFactor = 150;
-            if (track_progress < 128)
+            if (trackProgress < 128)
                 break;
             vertFactor = -150;
             // 6d7408
@@ -6124,63 +6068,63 @@ GForces Vehicle::GetGForces() const
             // 6d75A8
             break;
         case TRACK_ELEM_LEFT_BANK_TO_LEFT_QUARTER_TURN_3_TILES_25_DEG_UP:
-            vertFactor = -(track_progress / 2) + 134;
+            vertFactor = -(trackProgress / 2) + 134;
             lateralFactor = 90;
             // 6d771C
             break;
         case TRACK_ELEM_RIGHT_BANK_TO_RIGHT_QUARTER_TURN_3_TILES_25_DEG_UP:
-            vertFactor = -(track_progress / 2) + 134;
+            vertFactor = -(trackProgress / 2) + 134;
             lateralFactor = -90;
             // 6D7746
             break;
         case TRACK_ELEM_LEFT_QUARTER_TURN_3_TILES_25_DEG_DOWN_TO_LEFT_BANK:
-            vertFactor = -(track_progress / 2) + 134;
+            vertFactor = -(trackProgress / 2) + 134;
             lateralFactor = 90;
             // 6D7731 identical to 6d771c
             break;
         case TRACK_ELEM_RIGHT_QUARTER_TURN_3_TILES_25_DEG_DOWN_TO_RIGHT_BANK:
-            vertFactor = -(track_progress / 2) + 134;
+            vertFactor = -(trackProgress / 2) + 134;
             lateralFactor = -90;
             // 6D775B identical to 6d7746
             break;
         case TRACK_ELEM_LEFT_LARGE_HALF_LOOP_UP:
         case TRACK_ELEM_RIGHT_LARGE_HALF_LOOP_UP:
-            vertFactor = ((static_cast<uint16_t>(-(track_progress - 311))) / 4) + 46;
+            vertFactor = ((static_cast<uint16_t>(-(trackProgress - 311))) / 4) + 46;
             // 6d7666
             break;
         case TRACK_ELEM_RIGHT_LARGE_HALF_LOOP_DOWN:
         case TRACK_ELEM_LEFT_LARGE_HALF_LOOP_DOWN:
-            vertFactor = (track_progress / 4) + 46;
+            vertFactor = (trackProgress / 4) + 46;
             // 6d767F
             break;
         case TRACK_ELEM_HEARTLINE_TRANSFER_UP:
             vertFactor = 103;
-            if (track_progress < 32)
+            if (trackProgress < 32)
                 break;
             vertFactor = -103;
-            if (track_progress < 64)
+            if (trackProgress < 64)
                 break;
             vertFactor = 0;
-            if (track_progress < 96)
+            if (trackProgress < 96)
                 break;
             vertFactor = 103;
-            if (track_progress < 128)
+            if (trackProgress < 128)
                 break;
             vertFactor = -103;
             // 6d74A0
             break;
         case TRACK_ELEM_HEARTLINE_TRANSFER_DOWN:
             vertFactor = -103;
-            if (track_progress < 32)
+            if (trackProgress < 32)
                 break;
             vertFactor = 103;
-            if (track_progress < 64)
+            if (trackProgress < 64)
                 break;
             vertFactor = 0;
-            if (track_progress < 96)
+            if (trackProgress < 96)
                 break;
             vertFactor = -103;
-            if (track_progress < 128)
+            if (trackProgress < 128)
                 break;
             vertFactor = 103;
             // 6D74CA
@@ -6188,13 +6132,13 @@ GForces Vehicle::GetGForces() const
         case TRACK_ELEM_MULTIDIM_INVERTED_FLAT_TO_90_DEG_QUARTER_LOOP_DOWN:
         case TRACK_ELEM_INVERTED_FLAT_TO_90_DEG_QUARTER_LOOP_DOWN:
         case TRACK_ELEM_MULTIDIM_FLAT_TO_90_DEG_DOWN_QUARTER_LOOP:
-            vertFactor = (track_progress / 4) + 55;
+            vertFactor = (trackProgress / 4) + 55;
             // 6d762D
             break;
         case TRACK_ELEM_90_DEG_TO_INVERTED_FLAT_QUARTER_LOOP_UP:
         case TRACK_ELEM_MULTIDIM_90_DEG_UP_TO_INVERTED_FLAT_QUARTER_LOOP:
         case TRACK_ELEM_MULTIDIM_INVERTED_90_DEG_UP_TO_FLAT_QUARTER_LOOP:
-            vertFactor = ((static_cast<uint16_t>(-(track_progress - 137))) / 4) + 55;
+            vertFactor = ((static_cast<uint16_t>(-(trackProgress - 137))) / 4) + 55;
             // 6D7614
             break;
         case TRACK_ELEM_AIR_THRUST_TOP_CAP:
@@ -6226,6 +6170,103 @@ GForces Vehicle::GetGForces() const
             // 6d76F5
             break;
     }
+    return { vertFactor, lateralFactor };
+}
+
+struct TrackGForceProfile
+{
+    bool DependsOnProgress{};
+    GForceFactors Factors;
+};
+
+/**
+ * Works out once which track pieces have the same g-force factors along their whole length, so vehicles on those only
+ * need to look the factors up.
+ */
+static std::unique_ptr<TrackGForceProfile[]> vehicle_create_track_g_force_profiles()
+{
+    uint16_t maxTrackProgress = 0;
+    for (const auto& list : gTrackVehicleInfoTable.Lists)
+    {
+        maxTrackProgress = std::max(maxTrackProgress, list.size);
+    }
+
+    auto profiles = std::make_unique<TrackGForceProfile[]>(TRACK_ELEM_COUNT);
+    for (uint16_t trackType = 0; trackType < TRACK_ELEM_COUNT; trackType++)
+    {
+        auto& profile = profiles[trackType];
+        profile.Factors = vehicle_get_g_force_factors(trackType, 0);
+        for (uint16_t trackProgress = 1; trackProgress < maxTrackProgress; trackProgress++)
+        {
+            auto factors = vehicle_get_g_force_factors(trackType, trackProgress);
+            if (factors.Vertical != profile.Factors.Vertical || factors.Lateral != profile.Factors.Lateral)
+            {
+                profile.DependsOnProgress = true;
+                break;
+            }
+        }
+    }
+    return profiles;
+}
+
+static constexpr int32_t vehicle_get_gravity_g_force(size_t spriteType, size_t bankRotation)
+{
+    int32_t gForceVert = ((static_cast<int64_t>(0x280000)) * Unk9A37E4[spriteType]) >> 32;
+    return ((static_cast<int64_t>(gForceVert)) * Unk9A39C4[bankRotation]) >> 32;
+}
+
+static constexpr size_t NumGForceSpriteTypes = std::size(Unk9A37E4);
+static constexpr size_t NumGForceBankRotations = std::size(Unk9A39C4);
+
+static constexpr std::array<int32_t, NumGForceSpriteTypes * NumGForceBankRotations> vehicle_create_gravity_g_force_table()
+{
+    std::array<int32_t, NumGForceSpriteTypes * NumGForceBankRotations> table{};
+    for (size_t spriteType = 0; spriteType < NumGForceSpriteTypes; spriteType++)
+    {
+        for (size_t bankRotation = 0; bankRotation < NumGForceBankRotations; bankRotation++)
+        {
+            auto index = spriteType * NumGForceBankRotations + bankRotation;
+            table[index] = vehicle_get_gravity_g_force(spriteType, bankRotation);
+        }
+    }
+    return table;
+}
+
+/** The vertical g-force caused by gravity for each pitch and bank of a vehicle. */
+static constexpr auto GravityGForceTable = vehicle_create_gravity_g_force_table();
+
+/**
+ *
+ *  rct2: 0x006D73D0
+ * ax: verticalG
+ * dx: lateralG
+ * esi: vehicle
+ */
+GForces Vehicle::GetGForces() const
+{
+    int32_t gForceVert;
+    if (vehicle_sprite_type < NumGForceSpriteTypes && bank_rotation < NumGForceBankRotations)
+    {
+        gForceVert = GravityGForceTable[vehicle_sprite_type * NumGForceBankRotations + bank_rotation];
+    }
+    else
+    {
+        gForceVert = vehicle_get_gravity_g_force(vehicle_sprite_type, bank_rotation);
+    }
+
+    static const auto trackProfiles = vehicle_create_track_g_force_profiles();
+    auto trackType = GetTrackType();
+    GForceFactors factors;
+    if (trackType < TRACK_ELEM_COUNT && !trackProfiles[trackType].DependsOnProgress)
+    {
+        factors = trackProfiles[trackType].Factors;
+    }
+    else
+    {
+        factors = vehicle_get_g_force_factors(trackType, track_progress);
+    }
+    int32_t vertFactor = factors.Vertical;
+    int32_t lateralFactor = factors.Lateral;
 
     int32_t gForceLateral = 0;
 
@@ -6309,13 +6350,13 @@ int32_t Vehicle::IsUsedInPairs() const
  *
  *  rct2: 0x006DA44E
  */
-int32_t Vehicle::UpdateMotionDodgems()
+int32_t Vehicle::UpdateMotionDodgems(VehicleMotionContext& motion)
 {
-    _vehicleMotionTrackFlags = 0;
+    motion.MotionTrackFlags = 0;
 
     auto curRide = get_ride(ride);
     if (curRide == nullptr)
-        return _vehicleMotionTrackFlags;
+        return motion.MotionTrackFlags;
 
     int32_t nextVelocity = velocity + acceleration;
     if (curRide->lifecycle_flags & (RIDE_LIFECYCLE_BREAKDOWN_PENDING | RIDE_LIFECYCLE_BROKEN_DOWN)
@@ -6325,9 +6366,9 @@ int32_t Vehicle::UpdateMotionDodgems()
     }
     velocity = nextVelocity;
 
-    _vehicleVelocityF64E08 = nextVelocity;
-    _vehicleVelocityF64E0C = (nextVelocity / 1024) * 42;
-    _vehicleUnkF64E10 = 1;
+    motion.VelocityF64E08 = nextVelocity;
+    motion.VelocityF64E0C = (nextVelocity / 1024) * 42;
+    motion.UnkF64E10 = 1;
 
     acceleration = 0;
     if (!(curRide->lifecycle_flags & (RIDE_LIFECYCLE_BREAKDOWN_PENDING | RIDE_LIFECYCLE_BROKEN_DOWN))
@@ -6381,14 +6422,14 @@ int32_t Vehicle::UpdateMotionDodgems()
         }
     }
 
-    remaining_distance += _vehicleVelocityF64E0C;
+    remaining_distance += motion.VelocityF64E0C;
 
     if (remaining_distance >= 13962)
     {
         sound2_flags &= ~VEHICLE_SOUND2_FLAGS_LIFT_HILL;
-        unk_F64E20.x = x;
-        unk_F64E20.y = y;
-        unk_F64E20.z = z;
+        motion.UnkF64E20.x = x;
+        motion.UnkF64E20.y = y;
+        motion.UnkF64E20.z = z;
 
         Invalidate();
 
@@ -6398,7 +6439,7 @@ int32_t Vehicle::UpdateMotionDodgems()
             uint8_t direction = sprite_direction;
             direction |= var_35 & 1;
 
-            CoordsXY location = unk_F64E20;
+            CoordsXY location = motion.UnkF64E20;
             location.x += Unk9A36C4[direction].x;
             location.y += Unk9A36C4[direction].y;
 
@@ -6406,13 +6447,13 @@ int32_t Vehicle::UpdateMotionDodgems()
                 break;
 
             remaining_distance -= Unk9A36C4[direction].distance;
-            unk_F64E20.x = location.x;
-            unk_F64E20.y = location.y;
+            motion.UnkF64E20.x = location.x;
+            motion.UnkF64E20.y = location.y;
             if (remaining_distance < 13962)
             {
                 break;
             }
-            _vehicleUnkF64E10++;
+            motion.UnkF64E10++;
         }
 
         if (remaining_distance >= 13962)
@@ -6444,7 +6485,7 @@ int32_t Vehicle::UpdateMotionDodgems()
             }
         }
 
-        MoveTo(unk_F64E20);
+        MoveTo(motion.UnkF64E20);
         Invalidate();
     }
 
@@ -6462,7 +6503,7 @@ int32_t Vehicle::UpdateMotionDodgems()
     if (!(vehicleEntry->flags & VEHICLE_ENTRY_FLAG_POWERED))
     {
         acceleration = -eax;
-        return _vehicleMotionTrackFlags;
+        return motion.MotionTrackFlags;
     }
 
     int32_t ebx = (speed * mass) >> 2;
@@ -6476,7 +6517,7 @@ int32_t Vehicle::UpdateMotionDodgems()
     _eax /= ebx;
 
     acceleration = _eax - eax;
-    return _vehicleMotionTrackFlags;
+    return motion.MotionTrackFlags;
 }
 
 /**
@@ -6547,7 +6588,7 @@ bool Vehicle::DodgemsCarWouldCollideAt(const CoordsXY& coords, uint16_t* collide
  *
  *  rct2: 0x006DAB90
  */
-void Vehicle::UpdateTrackMotionUpStopCheck() const
+void Vehicle::UpdateTrackMotionUpStopCheck(VehicleMotionContext& motion) const
 {
     auto vehicleEntry = Entry();
     if (vehicleEntry == nullptr)
@@ -6580,7 +6621,7 @@ void Vehicle::UpdateTrackMotionUpStopCheck() const
 
             if (vehicle_sprite_type != 8)
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_DERAILED;
+                motion.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_DERAILED;
             }
         }
     }
@@ -6609,7 +6650,7 @@ void Vehicle::UpdateTrackMotionUpStopCheck() const
 
             if (vehicle_sprite_type != 8 && vehicle_sprite_type != 55)
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_DERAILED;
+                motion.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_DERAILED;
             }
         }
     }
@@ -6646,10 +6687,10 @@ void Vehicle::ApplyNonStopBlockBrake()
  *
  * Modifies the train's velocity influenced by a block brake
  */
-void Vehicle::ApplyStopBlockBrake()
+void Vehicle::ApplyStopBlockBrake(VehicleMotionContext& motion)
 {
     // Slow it down till completely stop the car
-    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_10;
+    motion.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_10;
     acceleration = 0;
     // If the this is slow enough, stop it. If not, slow it down
     if (velocity <= 0x20000)
@@ -6666,7 +6707,7 @@ void Vehicle::ApplyStopBlockBrake()
  *
  *  rct2: 0x006DAC43
  */
-void Vehicle::CheckAndApplyBlockSectionStopSite()
+void Vehicle::CheckAndApplyBlockSectionStopSite(VehicleMotionContext& motion)
 {
     auto curRide = get_ride(ride);
     if (curRide == nullptr)
@@ -6679,7 +6720,7 @@ void Vehicle::CheckAndApplyBlockSectionStopSite()
     // Is chair lift type
     if (vehicleEntry->flags & VEHICLE_ENTRY_FLAG_CHAIRLIFT)
     {
-        velocity = _vehicleBreakdown == 0 ? 0 : curRide->speed << 16;
+        velocity = motion.Breakdown == 0 ? 0 : curRide->speed << 16;
         acceleration = 0;
     }
 
@@ -6696,14 +6737,14 @@ void Vehicle::CheckAndApplyBlockSectionStopSite()
     {
         case TRACK_ELEM_BLOCK_BRAKES:
             if (curRide->IsBlockSectioned() && trackElement->AsTrack()->BlockBrakeClosed())
-                ApplyStopBlockBrake();
+                ApplyStopBlockBrake(motion);
             else
                 ApplyNonStopBlockBrake();
 
             break;
         case TRACK_ELEM_END_STATION:
             if (trackElement->AsTrack()->BlockBrakeClosed())
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_10;
+                motion.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_10;
 
             break;
         case TRACK_ELEM_25_DEG_UP_TO_FLAT:
@@ -6717,7 +6758,7 @@ void Vehicle::CheckAndApplyBlockSectionStopSite()
                 {
                     if (trackElement->AsTrack()->BlockBrakeClosed())
                     {
-                        ApplyStopBlockBrake();
+                        ApplyStopBlockBrake(motion);
                     }
                 }
             }
@@ -6729,7 +6770,7 @@ void Vehicle::CheckAndApplyBlockSectionStopSite()
  *
  *  rct2: 0x006DADAE
  */
-void Vehicle::UpdateVelocity()
+void Vehicle::UpdateVelocity(VehicleMotionContext& motion)
 {
     int32_t nextVelocity = acceleration + velocity;
     if (HasUpdateFlag(VEHICLE_UPDATE_FLAG_ZERO_VELOCITY))
@@ -6751,20 +6792,24 @@ void Vehicle::UpdateVelocity()
     }
     velocity = nextVelocity;
 
-    _vehicleVelocityF64E08 = nextVelocity;
-    _vehicleVelocityF64E0C = (nextVelocity >> 10) * 42;
+    motion.VelocityF64E08 = nextVelocity;
+    motion.VelocityF64E0C = (nextVelocity >> 10) * 42;
 }
 
-static void block_brakes_open_previous_section(Ride& ride, const CoordsXYZ& vehicleTrackLocation, TileElement* tileElement)
+static void block_brakes_open_previous_section(
+    Ride& ride, const CoordsXYZ& vehicleTrackLocation, const TrackGraphCursor& vehiclePiece)
 {
     auto location = vehicleTrackLocation;
     track_begin_end trackBeginEnd, slowTrackBeginEnd;
+    TrackGraphCursor cursor = vehiclePiece;
+    TileElement* tileElement = cursor.Element.element;
     TileElement slowTileElement = *tileElement;
     bool counter = true;
     CoordsXY slowLocation = location;
     do
     {
-        if (!track_block_get_previous({ location, tileElement }, &trackBeginEnd))
+        uint32_t previousPiece;
+        if (!track_graph_get_previous(cursor, &trackBeginEnd, &previousPiece))
         {
             return;
         }
@@ -6778,6 +6823,7 @@ static void block_brakes_open_previous_section(Ride& ride, const CoordsXYZ& vehi
         location.y = trackBeginEnd.end_y;
         location.z = trackBeginEnd.begin_z;
         tileElement = trackBeginEnd.begin_element;
+        cursor = { { location, tileElement }, previousPiece };
 
         //#2081: prevent infinite loop
         counter = !counter;
@@ -6940,9 +6986,9 @@ int32_t Vehicle::GetSwingAmount() const
  *
  *  rct2: 0x006D6776
  */
-void Vehicle::UpdateSwingingCar()
+void Vehicle::UpdateSwingingCar(VehicleMotionContext& motion)
 {
-    int32_t dword_F64E08 = abs(_vehicleVelocityF64E08);
+    int32_t dword_F64E08 = abs(motion.VelocityF64E08);
     SwingSpeed += (-SwingPosition) >> 6;
     int32_t swingAmount = GetSwingAmount();
     if (swingAmount < 0)
@@ -7124,7 +7170,7 @@ static const uint8_t TrackTypeToSpinFunction[256] = {
  *
  *  rct2: 0x006D661F
  */
-void Vehicle::UpdateSpinningCar()
+void Vehicle::UpdateSpinningCar(VehicleMotionContext& motion)
 {
     if (HasUpdateFlag(VEHICLE_UPDATE_FLAG_ROTATION_OFF_WILD_MOUSE))
     {
@@ -7139,7 +7185,7 @@ void Vehicle::UpdateSpinningCar()
     }
     int32_t spinningInertia = vehicleEntry->spinning_inertia;
     int32_t trackType = GetTrackType();
-    int32_t dword_F64E08 = _vehicleVelocityF64E08;
+    int32_t dword_F64E08 = motion.VelocityF64E08;
     int32_t spinSpeed;
     // An L spin adds to the spin speed, R does the opposite
     // The number indicates how much right shift of the velocity will become spin
@@ -7261,7 +7307,7 @@ static void steam_particle_create(int16_t x, int16_t y, int16_t z)
  *
  *  rct2: 0x006D63D4
  */
-void Vehicle::UpdateAdditionalAnimation()
+void Vehicle::UpdateAdditionalAnimation(VehicleMotionContext& motion)
 {
     uint8_t al, ah;
     uint32_t eax;
@@ -7275,7 +7321,7 @@ void Vehicle::UpdateAdditionalAnimation()
     switch (vehicleEntry->animation)
     {
         case VEHICLE_ENTRY_ANIMATION_MINITURE_RAILWAY_LOCOMOTIVE: // loc_6D652B
-            *curVar_C8 += _vehicleVelocityF64E08;
+            *curVar_C8 += motion.VelocityF64E08;
             al = (*curVar_C8 >> 20) & 3;
             if (animation_frame != al)
             {
@@ -7315,7 +7361,7 @@ void Vehicle::UpdateAdditionalAnimation()
             }
             break;
         case VEHICLE_ENTRY_ANIMATION_SWAN: // loc_6D6424
-            *curVar_C8 += _vehicleVelocityF64E08;
+            *curVar_C8 += motion.VelocityF64E08;
             al = (*curVar_C8 >> 18) & 2;
             if (animation_frame != al)
             {
@@ -7324,7 +7370,7 @@ void Vehicle::UpdateAdditionalAnimation()
             }
             break;
         case VEHICLE_ENTRY_ANIMATION_CANOES: // loc_6D6482
-            *curVar_C8 += _vehicleVelocityF64E08;
+            *curVar_C8 += motion.VelocityF64E08;
             eax = ((*curVar_C8 >> 13) & 0xFF) * 6;
             ah = (eax >> 8) & 0xFF;
             if (animation_frame != ah)
@@ -7334,7 +7380,7 @@ void Vehicle::UpdateAdditionalAnimation()
             }
             break;
         case VEHICLE_ENTRY_ANIMATION_ROW_BOATS: // loc_6D64F7
-            *curVar_C8 += _vehicleVelocityF64E08;
+            *curVar_C8 += motion.VelocityF64E08;
             eax = ((*curVar_C8 >> 13) & 0xFF) * 7;
             ah = (eax >> 8) & 0xFF;
             if (animation_frame != ah)
@@ -7344,7 +7390,7 @@ void Vehicle::UpdateAdditionalAnimation()
             }
             break;
         case VEHICLE_ENTRY_ANIMATION_WATER_TRICYCLES: // loc_6D6453
-            *curVar_C8 += _vehicleVelocityF64E08;
+            *curVar_C8 += motion.VelocityF64E08;
             al = (*curVar_C8 >> 19) & 1;
             if (animation_frame != al)
             {
@@ -7366,7 +7412,7 @@ void Vehicle::UpdateAdditionalAnimation()
             }
             break;
         case VEHICLE_ENTRY_ANIMATION_HELICARS: // loc_6D63F5
-            *curVar_C8 += _vehicleVelocityF64E08;
+            *curVar_C8 += motion.VelocityF64E08;
             al = (*curVar_C8 >> 18) & 3;
             if (animation_frame != al)
             {
@@ -7377,7 +7423,7 @@ void Vehicle::UpdateAdditionalAnimation()
         case VEHICLE_ENTRY_ANIMATION_MONORAIL_CYCLES: // loc_6D64B6
             if (num_peeps != 0)
             {
-                *curVar_C8 += _vehicleVelocityF64E08;
+                *curVar_C8 += motion.VelocityF64E08;
                 eax = ((*curVar_C8 >> 13) & 0xFF) << 2;
                 ah = (eax >> 8) & 0xFF;
                 if (animation_frame != ah)
@@ -7497,7 +7543,7 @@ void Vehicle::UpdateSceneryDoor() const
  *
  *  rct2: 0x006DB38B
  */
-static bool loc_6DB38B(Vehicle* vehicle, TileElement* tileElement)
+static bool loc_6DB38B(VehicleMotionContext& motion, Vehicle* vehicle, TileElement* tileElement)
 {
     // Get bank
     int32_t bankStart = track_get_actual_bank_3(vehicle, tileElement);
@@ -7506,7 +7552,7 @@ static bool loc_6DB38B(Vehicle* vehicle, TileElement* tileElement)
     int32_t trackType = tileElement->AsTrack()->GetTrackType();
     int32_t vangleStart = TrackDefinitions[trackType].vangle_start;
 
-    return vangleStart == _vehicleVAngleEndF64E36 && bankStart == _vehicleBankEndF64E37;
+    return vangleStart == motion.VAngleEndF64E36 && bankStart == motion.BankEndF64E37;
 }
 
 void Vehicle::UpdateGoKartAttemptSwitchLanes()
@@ -7555,21 +7601,21 @@ void Vehicle::UpdateSceneryDoorBackwards() const
         { wallCoords, static_cast<Direction>(direction) }, TrackLocation, next_vehicle_on_train == SPRITE_INDEX_NULL);
 }
 
-static void vehicle_update_play_water_splash_sound()
+static void vehicle_update_play_water_splash_sound(VehicleMotionContext& motion)
 {
-    if (_vehicleVelocityF64E08 <= BLOCK_BRAKE_BASE_SPEED)
+    if (motion.VelocityF64E08 <= BLOCK_BRAKE_BASE_SPEED)
     {
         return;
     }
 
-    audio_play_sound_at_location(SoundId::WaterSplash, { unk_F64E20.x, unk_F64E20.y, unk_F64E20.z });
+    audio_play_sound_at_location(SoundId::WaterSplash, motion.UnkF64E20);
 }
 
 /**
  *
  *  rct2: 0x006DB59E
  */
-void Vehicle::UpdateHandleWaterSplash() const
+void Vehicle::UpdateHandleWaterSplash(VehicleMotionContext& motion) const
 {
     rct_ride_entry* rideEntry = GetRideEntry();
     int32_t trackType = GetTrackType();
@@ -7588,7 +7634,7 @@ void Vehicle::UpdateHandleWaterSplash() const
                     {
                         if (track_progress == 4)
                         {
-                            vehicle_update_play_water_splash_sound();
+                            vehicle_update_play_water_splash_sound(motion);
                         }
                     }
                 }
@@ -7601,7 +7647,7 @@ void Vehicle::UpdateHandleWaterSplash() const
         {
             if (track_progress == 12)
             {
-                vehicle_update_play_water_splash_sound();
+                vehicle_update_play_water_splash_sound(motion);
             }
         }
     }
@@ -7611,7 +7657,7 @@ void Vehicle::UpdateHandleWaterSplash() const
         {
             if (track_progress == 48)
             {
-                vehicle_update_play_water_splash_sound();
+                vehicle_update_play_water_splash_sound(motion);
             }
         }
     }
@@ -7846,11 +7892,11 @@ void Vehicle::ReverseReverserCar()
  *
  *  rct2: 0x006DBF3E
  */
-static void sub_6DBF3E(Vehicle* vehicle)
+static void sub_6DBF3E(VehicleMotionContext& motion, Vehicle* vehicle)
 {
     rct_ride_entry_vehicle* vehicleEntry = vehicle->Entry();
 
-    vehicle->acceleration = vehicle->acceleration / _vehicleUnkF64E10;
+    vehicle->acceleration = vehicle->acceleration / motion.UnkF64E10;
     if (vehicle->TrackSubposition == VEHICLE_TRACK_SUBPOSITION_CHAIRLIFT_GOING_BACK)
     {
         return;
@@ -7862,55 +7908,55 @@ static void sub_6DBF3E(Vehicle* vehicle)
         return;
     }
 
-    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_3;
+    motion.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_3;
 
-    TileElement* tileElement = nullptr;
+    TrackGraphCursor trackPiece;
     if (map_is_location_valid(vehicle->TrackLocation))
     {
-        tileElement = map_get_track_element_at_of_type_seq(vehicle->TrackLocation, trackType, 0);
+        trackPiece = track_graph_get_piece(vehicle->ride, vehicle->TrackLocation, trackType);
     }
 
+    TileElement* tileElement = trackPiece.Element.element;
     if (tileElement == nullptr)
     {
         return;
     }
 
-    if (_vehicleStationIndex == STATION_INDEX_NULL)
+    if (motion.CurrentStation == STATION_INDEX_NULL)
     {
-        _vehicleStationIndex = tileElement->AsTrack()->GetStationIndex();
+        motion.CurrentStation = tileElement->AsTrack()->GetStationIndex();
     }
 
-    if (trackType == TRACK_ELEM_TOWER_BASE && vehicle == gCurrentVehicle)
+    if (trackType == TRACK_ELEM_TOWER_BASE && vehicle == motion.CurrentVehicle)
     {
         if (vehicle->track_progress > 3 && !vehicle->HasUpdateFlag(VEHICLE_UPDATE_FLAG_REVERSING_SHUTTLE))
         {
-            CoordsXYE output;
+            TrackGraphCursor output;
             int32_t outputZ, outputDirection;
 
-            CoordsXYE input = { vehicle->TrackLocation, tileElement };
-            if (!track_block_get_next(&input, &output, &outputZ, &outputDirection))
+            if (!track_graph_get_next(trackPiece, &output, &outputZ, &outputDirection))
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_12;
+                motion.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_12;
             }
         }
 
         if (vehicle->track_progress <= 3)
         {
-            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
+            motion.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
         }
     }
 
-    if (trackType != TRACK_ELEM_END_STATION || vehicle != gCurrentVehicle)
+    if (trackType != TRACK_ELEM_END_STATION || vehicle != motion.CurrentVehicle)
     {
         return;
     }
 
     uint16_t ax = vehicle->track_progress;
-    if (_vehicleVelocityF64E08 < 0)
+    if (motion.VelocityF64E08 < 0)
     {
         if (ax <= 22)
         {
-            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
+            motion.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
         }
     }
     else
@@ -7930,7 +7976,7 @@ static void sub_6DBF3E(Vehicle* vehicle)
 
         if (ax > cx)
         {
-            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
+            motion.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
         }
     }
 }
@@ -7939,22 +7985,24 @@ static void sub_6DBF3E(Vehicle* vehicle)
  *
  *  rct2: 0x006DB08C
  */
-bool Vehicle::UpdateTrackMotionForwardsGetNewTrack(uint16_t trackType, Ride* curRide, rct_ride_entry* rideEntry)
+bool Vehicle::UpdateTrackMotionForwardsGetNewTrack(
+    VehicleMotionContext& motion, uint16_t trackType, Ride* curRide, rct_ride_entry* rideEntry)
 {
     CoordsXYZD location = {};
 
-    _vehicleVAngleEndF64E36 = TrackDefinitions[trackType].vangle_end;
-    _vehicleBankEndF64E37 = TrackDefinitions[trackType].bank_end;
-    TileElement* tileElement = map_get_track_element_at_of_type_seq(TrackLocation, trackType, 0);
+    motion.VAngleEndF64E36 = TrackDefinitions[trackType].vangle_end;
+    motion.BankEndF64E37 = TrackDefinitions[trackType].bank_end;
+    TrackGraphCursor trackPiece = track_graph_get_piece(ride, TrackLocation, trackType);
+    TileElement* tileElement = trackPiece.Element.element;
 
     if (tileElement == nullptr)
     {
         return false;
     }
 
-    if (trackType == TRACK_ELEM_CABLE_LIFT_HILL && this == gCurrentVehicle)
+    if (trackType == TRACK_ELEM_CABLE_LIFT_HILL && this == motion.CurrentVehicle)
     {
-        _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_11;
+        motion.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_11;
     }
 
     if (track_element_is_block_start(tileElement))
@@ -7970,7 +8018,7 @@ bool Vehicle::UpdateTrackMotionForwardsGetNewTrack(uint16_t trackType, Ride* cur
                 }
             }
             map_invalidate_element(TrackLocation, tileElement);
-            block_brakes_open_previous_section(*curRide, TrackLocation, tileElement);
+            block_brakes_open_previous_section(*curRide, TrackLocation, trackPiece);
         }
     }
 
@@ -8001,7 +8049,7 @@ bool Vehicle::UpdateTrackMotionForwardsGetNewTrack(uint16_t trackType, Ride* cur
     if (isGoingBack)
     {
         track_begin_end trackBeginEnd;
-        if (!track_block_get_previous({ TrackLocation, tileElement }, &trackBeginEnd))
+        if (!track_graph_get_previous(trackPiece, &trackBeginEnd, nullptr))
         {
             return false;
         }
@@ -8015,13 +8063,13 @@ bool Vehicle::UpdateTrackMotionForwardsGetNewTrack(uint16_t trackType, Ride* cur
     {
         {
             int32_t curZ, direction;
-            CoordsXYE xyElement = { TrackLocation, tileElement };
-            if (!track_block_get_next(&xyElement, &xyElement, &curZ, &direction))
+            TrackGraphCursor nextPiece;
+            if (!track_graph_get_next(trackPiece, &nextPiece, &curZ, &direction))
             {
                 return false;
             }
-            tileElement = xyElement.element;
-            location = { xyElement, curZ, static_cast<Direction>(direction) };
+            tileElement = nextPiece.Element.element;
+            location = { nextPiece.Element, curZ, static_cast<Direction>(direction) };
         }
         if (tileElement->AsTrack()->GetTrackType() == TRACK_ELEM_LEFT_REVERSER
             || tileElement->AsTrack()->GetTrackType() == TRACK_ELEM_RIGHT_REVERSER)
@@ -8032,7 +8080,7 @@ bool Vehicle::UpdateTrackMotionForwardsGetNewTrack(uint16_t trackType, Ride* cur
             }
         }
 
-        if (!loc_6DB38B(this, tileElement))
+        if (!loc_6DB38B(motion, this, tileElement))
         {
             return false;
         }
@@ -8126,7 +8174,8 @@ bool Vehicle::UpdateTrackMotionForwardsGetNewTrack(uint16_t trackType, Ride* cur
  *
  *  rct2: 0x006DAEB9
  */
-bool Vehicle::UpdateTrackMotionForwards(rct_ride_entry_vehicle* vehicleEntry, Ride* curRide, rct_ride_entry* rideEntry)
+bool Vehicle::UpdateTrackMotionForwards(
+    VehicleMotionContext& motion, rct_ride_entry_vehicle* vehicleEntry, Ride* curRide, rct_ride_entry* rideEntry)
 {
     uint16_t otherVehicleIndex = SPRITE_INDEX_NULL;
     do
@@ -8139,11 +8188,11 @@ bool Vehicle::UpdateTrackMotionForwards(rct_ride_entry_vehicle* vehicleEntry, Ri
                 vehicle_type ^= 1;
                 vehicleEntry = Entry();
             }
-            if (_vehicleVelocityF64E08 >= 0x40000)
+            if (motion.VelocityF64E08 >= 0x40000)
             {
-                acceleration = -_vehicleVelocityF64E08 * 8;
+                acceleration = -motion.VelocityF64E08 * 8;
             }
-            else if (_vehicleVelocityF64E08 < 0x20000)
+            else if (motion.VelocityF64E08 < 0x20000)
             {
                 acceleration = 0x50000;
             }
@@ -8156,15 +8205,15 @@ bool Vehicle::UpdateTrackMotionForwards(rct_ride_entry_vehicle* vehicleEntry, Ri
             {
                 //regs.eax = brake_speed << 16;
                 int32_t breaksAcceleration = brake_speed << 16;
-                if (breaksAcceleration < _vehicleVelocityF64E08)
+                if (breaksAcceleration < motion.VelocityF64E08)
                 {
-                    acceleration = -_vehicleVelocityF64E08 * 16;
+                    acceleration = -motion.VelocityF64E08 * 16;
                 }
                 else if (!(gCurrentTicks & 0x0F))
                 {
-                    if (_vehicleF64E2C == 0)
+                    if (motion.F64E2C == 0)
                     {
-                        _vehicleF64E2C++;
+                        motion.F64E2C++;
                         audio_play_sound_at_location(SoundId::BrakeRelease, { x, y, z });
                     }
                 }
@@ -8174,10 +8223,10 @@ bool Vehicle::UpdateTrackMotionForwards(rct_ride_entry_vehicle* vehicleEntry, Ri
         {
             int32_t boostersAcceleration = get_booster_speed(curRide->type, (brake_speed << 16));
 
-            if (boostersAcceleration > _vehicleVelocityF64E08)
+            if (boostersAcceleration > motion.VelocityF64E08)
             {
                 acceleration = RideTypeDescriptors[curRide->type].OperatingSettings.BoosterAcceleration
-                    << 16; //_vehicleVelocityF64E08 * 1.2;
+                    << 16; //motion.VelocityF64E08 * 1.2;
             }
         }
         else if ((trackType == TRACK_ELEM_FLAT && curRide->type == RIDE_TYPE_REVERSE_FREEFALL_COASTER)
@@ -8193,7 +8242,7 @@ bool Vehicle::UpdateTrackMotionForwards(rct_ride_entry_vehicle* vehicleEntry, Ri
                 {
                     if (track_progress >= 8)
                     {
-                        acceleration = -_vehicleVelocityF64E08 * 16;
+                        acceleration = -motion.VelocityF64E08 * 16;
                         if (track_progress >= 24)
                         {
                             SetUpdateFlag(VEHICLE_UPDATE_FLAG_ON_BRAKE_FOR_DROP);
@@ -8227,10 +8276,10 @@ bool Vehicle::UpdateTrackMotionForwards(rct_ride_entry_vehicle* vehicleEntry, Ri
         {
             UpdateCrossings();
 
-            if (!UpdateTrackMotionForwardsGetNewTrack(trackType, curRide, rideEntry))
+            if (!UpdateTrackMotionForwardsGetNewTrack(motion, trackType, curRide, rideEntry))
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
-                _vehicleVelocityF64E0C -= remaining_distance + 1;
+                motion.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
+                motion.VelocityF64E0C -= remaining_distance + 1;
                 remaining_distance = -1;
                 return false;
             }
@@ -8238,7 +8287,7 @@ bool Vehicle::UpdateTrackMotionForwards(rct_ride_entry_vehicle* vehicleEntry, Ri
         }
 
         track_progress = track;
-        UpdateHandleWaterSplash();
+        UpdateHandleWaterSplash(motion);
 
         // loc_6DB706
         int32_t sprite;
@@ -8250,15 +8299,15 @@ bool Vehicle::UpdateTrackMotionForwards(rct_ride_entry_vehicle* vehicleEntry, Ri
             int16_t curZ = TrackLocation.z + moveInfo->z + RideTypeDescriptors[curRide->type].Heights.VehicleZOffset;
 
             int32_t position = 0;
-            if (curX != unk_F64E20.x)
+            if (curX != motion.UnkF64E20.x)
             {
                 position |= 1;
             }
-            if (curY != unk_F64E20.y)
+            if (curY != motion.UnkF64E20.y)
             {
                 position |= 2;
             }
-            if (curZ != unk_F64E20.z)
+            if (curZ != motion.UnkF64E20.z)
             {
                 position |= 4;
             }
@@ -8282,9 +8331,9 @@ bool Vehicle::UpdateTrackMotionForwards(rct_ride_entry_vehicle* vehicleEntry, Ri
 
             // loc_6DB8A5
             remaining_distance -= dword_9A2930[position];
-            unk_F64E20.x = curX;
-            unk_F64E20.y = curY;
-            unk_F64E20.z = curZ;
+            motion.UnkF64E20.x = curX;
+            motion.UnkF64E20.y = curY;
+            motion.UnkF64E20.z = curZ;
             sprite_direction = moveInfo->direction;
             bank_rotation = moveInfo->bank_rotation;
             vehicle_sprite_type = moveInfo->vehicle_sprite_type;
@@ -8298,18 +8347,19 @@ bool Vehicle::UpdateTrackMotionForwards(rct_ride_entry_vehicle* vehicleEntry, Ri
                 SwingSpeed = 0;
             }
 
-            if (this == _vehicleFrontVehicle)
+            if (this == motion.FrontVehicle)
             {
-                if (_vehicleVelocityF64E08 >= 0)
+                if (motion.VelocityF64E08 >= 0)
                 {
                     otherVehicleIndex = prev_vehicle_on_ride;
                     if (vehicle_update_motion_collision_detection(this, curX, curY, curZ, &otherVehicleIndex))
                     {
-                        _vehicleVelocityF64E0C -= remaining_distance + 1;
+                        motion.VelocityF64E0C -= remaining_distance + 1;
                         remaining_distance = -1;
                         // Might need to be bp rather than this, but hopefully not
                         auto head = (GET_VEHICLE(otherVehicleIndex))->TrainHead();
-                        return VehicleColision(this, head, vehicleEntry, rideEntry, VEHICLE_UPDATE_MOTION_TRACK_FLAG_1);
+                        return VehicleColision(
+                            motion, this, head, vehicleEntry, rideEntry, VEHICLE_UPDATE_MOTION_TRACK_FLAG_1);
                     }
                 }
             }
@@ -8317,7 +8367,7 @@ bool Vehicle::UpdateTrackMotionForwards(rct_ride_entry_vehicle* vehicleEntry, Ri
 
         sprite = dword_9A2970[sprite];
         acceleration += sprite;
-        _vehicleUnkF64E10++;
+        motion.UnkF64E10++;
     } while (remaining_distance >= 0x368A);
 
     return true;
@@ -8327,11 +8377,13 @@ bool Vehicle::UpdateTrackMotionForwards(rct_ride_entry_vehicle* vehicleEntry, Ri
  *
  *  rct2: 0x006DBAA6
  */
-bool Vehicle::UpdateTrackMotionBackwardsGetNewTrack(uint16_t trackType, Ride* curRide, uint16_t* progress)
+bool Vehicle::UpdateTrackMotionBackwardsGetNewTrack(
+    VehicleMotionContext& motion, uint16_t trackType, Ride* curRide, uint16_t* progress)
 {
-    _vehicleVAngleEndF64E36 = TrackDefinitions[trackType].vangle_start;
-    _vehicleBankEndF64E37 = TrackDefinitions[trackType].bank_start;
-    TileElement* tileElement = map_get_track_element_at_of_type_seq(TrackLocation, trackType, 0);
+    motion.VAngleEndF64E36 = TrackDefinitions[trackType].vangle_start;
+    motion.BankEndF64E37 = TrackDefinitions[trackType].bank_start;
+    TrackGraphCursor trackPiece = track_graph_get_piece(ride, TrackLocation, trackType);
+    TileElement* tileElement = trackPiece.Element.element;
 
     if (tileElement == nullptr)
         return false;
@@ -8363,7 +8415,7 @@ bool Vehicle::UpdateTrackMotionBackwardsGetNewTrack(uint16_t trackType, Ride* cu
     {
         // loc_6DBB7E:;
         track_begin_end trackBeginEnd;
-        if (!track_block_get_previous({ trackPos, tileElement }, &trackBeginEnd))
+        if (!track_graph_get_previous(trackPiece, &trackBeginEnd, nullptr))
         {
             return false;
         }
@@ -8379,7 +8431,7 @@ bool Vehicle::UpdateTrackMotionBackwardsGetNewTrack(uint16_t trackType, Ride* cu
         int32_t bank = TrackDefinitions[trackType].bank_end;
         bank = track_get_actual_bank_2(curRide->type, isInverted, bank);
         int32_t vAngle = TrackDefinitions[trackType].vangle_end;
-        if (_vehicleVAngleEndF64E36 != vAngle || _vehicleBankEndF64E37 != bank)
+        if (motion.VAngleEndF64E36 != vAngle || motion.BankEndF64E37 != bank)
         {
             return false;
         }
@@ -8400,19 +8452,15 @@ bool Vehicle::UpdateTrackMotionBackwardsGetNewTrack(uint16_t trackType, Ride* cu
     else
     {
         // loc_6DBB4F:;
-        CoordsXYE input;
-        CoordsXYE output;
+        TrackGraphCursor output;
         int32_t outputZ;
 
-        input.x = trackPos.x;
-        input.y = trackPos.y;
-        input.element = tileElement;
-        if (!track_block_get_next(&input, &output, &outputZ, &direction))
+        if (!track_graph_get_next(trackPiece, &output, &outputZ, &direction))
         {
             return false;
         }
-        tileElement = output.element;
-        trackPos = { output, outputZ };
+        tileElement = output.Element.element;
+        trackPos = { output.Element, outputZ };
     }
 
     // loc_6DBC3B:
@@ -8435,14 +8483,14 @@ bool Vehicle::UpdateTrackMotionBackwardsGetNewTrack(uint16_t trackType, Ride* cu
 
     if (tileElement->AsTrack()->HasChain())
     {
-        if (_vehicleVelocityF64E08 < 0)
+        if (motion.VelocityF64E08 < 0)
         {
             if (next_vehicle_on_train == SPRITE_INDEX_NULL)
             {
                 trackType = tileElement->AsTrack()->GetTrackType();
                 if (!(TrackFlags[trackType] & TRACK_ELEM_FLAG_DOWN))
                 {
-                    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_9;
+                    motion.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_9;
                 }
             }
             SetUpdateFlag(VEHICLE_UPDATE_FLAG_ON_LIFT_HILL);
@@ -8455,9 +8503,9 @@ bool Vehicle::UpdateTrackMotionBackwardsGetNewTrack(uint16_t trackType, Ride* cu
             ClearUpdateFlag(VEHICLE_UPDATE_FLAG_ON_LIFT_HILL);
             if (next_vehicle_on_train == SPRITE_INDEX_NULL)
             {
-                if (_vehicleVelocityF64E08 < 0)
+                if (motion.VelocityF64E08 < 0)
                 {
-                    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_8;
+                    motion.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_8;
                 }
             }
         }
@@ -8483,7 +8531,8 @@ bool Vehicle::UpdateTrackMotionBackwardsGetNewTrack(uint16_t trackType, Ride* cu
  *
  *  rct2: 0x006DBA33
  */
-bool Vehicle::UpdateTrackMotionBackwards(rct_ride_entry_vehicle* vehicleEntry, Ride* curRide, rct_ride_entry* rideEntry)
+bool Vehicle::UpdateTrackMotionBackwards(
+    VehicleMotionContext& motion, rct_ride_entry_vehicle* vehicleEntry, Ride* curRide, rct_ride_entry* rideEntry)
 {
     uint16_t otherVehicleIndex = SPRITE_INDEX_NULL;
     do
@@ -8491,7 +8540,7 @@ bool Vehicle::UpdateTrackMotionBackwards(rct_ride_entry_vehicle* vehicleEntry, R
         uint16_t trackType = GetTrackType();
         if (trackType == TRACK_ELEM_FLAT && curRide->type == RIDE_TYPE_REVERSE_FREEFALL_COASTER)
         {
-            int32_t unkVelocity = _vehicleVelocityF64E08;
+            int32_t unkVelocity = motion.VelocityF64E08;
             if (unkVelocity < -524288)
             {
                 unkVelocity = abs(unkVelocity);
@@ -8501,9 +8550,9 @@ bool Vehicle::UpdateTrackMotionBackwards(rct_ride_entry_vehicle* vehicleEntry, R
         else if (trackType == TRACK_ELEM_BRAKES)
         {
             int16_t breaksAcceleration = -(brake_speed << 16);
-            if (breaksAcceleration > _vehicleVelocityF64E08)
+            if (breaksAcceleration > motion.VelocityF64E08)
             {
-                breaksAcceleration = _vehicleVelocityF64E08 * -16;
+                breaksAcceleration = motion.VelocityF64E08 * -16;
                 acceleration = breaksAcceleration;
             }
         }
@@ -8511,7 +8560,7 @@ bool Vehicle::UpdateTrackMotionBackwards(rct_ride_entry_vehicle* vehicleEntry, R
         {
             int32_t boostersAcceleration = get_booster_speed(curRide->type, (brake_speed << 16));
 
-            if (boostersAcceleration < _vehicleVelocityF64E08)
+            if (boostersAcceleration < motion.VelocityF64E08)
             {
                 acceleration = RideTypeDescriptors[curRide->type].OperatingSettings.BoosterAcceleration << 16;
             }
@@ -8522,10 +8571,10 @@ bool Vehicle::UpdateTrackMotionBackwards(rct_ride_entry_vehicle* vehicleEntry, R
         {
             UpdateCrossings();
 
-            if (!UpdateTrackMotionBackwardsGetNewTrack(trackType, curRide, reinterpret_cast<uint16_t*>(&track)))
+            if (!UpdateTrackMotionBackwardsGetNewTrack(motion, trackType, curRide, reinterpret_cast<uint16_t*>(&track)))
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
-                _vehicleVelocityF64E0C -= remaining_distance - 0x368A;
+                motion.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
+                motion.VelocityF64E0C -= remaining_distance - 0x368A;
                 remaining_distance = 0x368A;
                 return false;
             }
@@ -8540,23 +8589,23 @@ bool Vehicle::UpdateTrackMotionBackwards(rct_ride_entry_vehicle* vehicleEntry, R
         int16_t curZ = TrackLocation.z + moveInfo->z + RideTypeDescriptors[curRide->type].Heights.VehicleZOffset;
 
         int32_t position = 0;
-        if (curX != unk_F64E20.x)
+        if (curX != motion.UnkF64E20.x)
         {
             position |= 1;
         }
-        if (curY != unk_F64E20.y)
+        if (curY != motion.UnkF64E20.y)
         {
             position |= 2;
         }
-        if (curZ != unk_F64E20.z)
+        if (curZ != motion.UnkF64E20.z)
         {
             position |= 4;
         }
         remaining_distance += dword_9A2930[position];
 
-        unk_F64E20.x = curX;
-        unk_F64E20.y = curY;
-        unk_F64E20.z = curZ;
+        motion.UnkF64E20.x = curX;
+        motion.UnkF64E20.y = curY;
+        motion.UnkF64E20.z = curZ;
         sprite_direction = moveInfo->direction;
         bank_rotation = moveInfo->bank_rotation;
         sprite = moveInfo->vehicle_sprite_type;
@@ -8570,17 +8619,17 @@ bool Vehicle::UpdateTrackMotionBackwards(rct_ride_entry_vehicle* vehicleEntry, R
             SwingSpeed = 0;
         }
 
-        if (this == _vehicleFrontVehicle)
+        if (this == motion.FrontVehicle)
         {
-            if (_vehicleVelocityF64E08 < 0)
+            if (motion.VelocityF64E08 < 0)
             {
                 otherVehicleIndex = next_vehicle_on_ride;
                 if (vehicle_update_motion_collision_detection(this, curX, curY, curZ, &otherVehicleIndex))
                 {
-                    _vehicleVelocityF64E0C -= remaining_distance - 0x368A;
+                    motion.VelocityF64E0C -= remaining_distance - 0x368A;
                     remaining_distance = 0x368A;
                     return VehicleColision(
-                        gCurrentVehicle, GET_VEHICLE(otherVehicleIndex), vehicleEntry, rideEntry,
+                        motion, motion.CurrentVehicle, GET_VEHICLE(otherVehicleIndex), vehicleEntry, rideEntry,
                         VEHICLE_UPDATE_MOTION_TRACK_FLAG_2);
                 }
             }
@@ -8588,7 +8637,7 @@ bool Vehicle::UpdateTrackMotionBackwards(rct_ride_entry_vehicle* vehicleEntry, R
 
         sprite = dword_9A2970[sprite];
         acceleration += sprite;
-        _vehicleUnkF64E10++;
+        motion.UnkF64E10++;
     } while (remaining_distance < 0);
 
     return true;
@@ -8598,8 +8647,8 @@ bool Vehicle::UpdateTrackMotionBackwards(rct_ride_entry_vehicle* vehicleEntry, R
  *
  */
 bool Vehicle::VehicleColision(
-    Vehicle* currentVehicle, Vehicle* otherVehicle, rct_ride_entry_vehicle* vehicleEntry, rct_ride_entry* rideEntry,
-    uint32_t MotionTrackFlag)
+    VehicleMotionContext& motion, Vehicle* currentVehicle, Vehicle* otherVehicle, rct_ride_entry_vehicle* vehicleEntry,
+    rct_ride_entry* rideEntry, uint32_t MotionTrackFlag)
 {
     int32_t delta_velocity = abs(currentVehicle->velocity - otherVehicle->velocity);
     if (!(rideEntry->flags & RIDE_ENTRY_FLAG_DISABLE_COLLISION_CRASHES))
@@ -8608,7 +8657,7 @@ bool Vehicle::VehicleColision(
         {
             if (!(vehicleEntry->flags & VEHICLE_ENTRY_FLAG_BOAT_HIRE_COLLISION_DETECTION))
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_COLLISION;
+                motion.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_COLLISION;
             }
         }
     }
@@ -8623,7 +8672,7 @@ bool Vehicle::VehicleColision(
         currentVehicle->velocity = otherVehicle->velocity >> 1;
         otherVehicle->velocity = newOtherVelocity;
     }
-    _vehicleMotionTrackFlags |= MotionTrackFlag;
+    motion.MotionTrackFlags |= MotionTrackFlag;
     return false;
 }
 
@@ -8632,23 +8681,25 @@ bool Vehicle::VehicleColision(
  *
  *
  */
-void Vehicle::UpdateTrackMotionMiniGolfVehicle(Ride* curRide, rct_ride_entry* rideEntry, rct_ride_entry_vehicle* vehicleEntry)
+void Vehicle::UpdateTrackMotionMiniGolfVehicle(
+    VehicleMotionContext& motion, Ride* curRide, rct_ride_entry* rideEntry, rct_ride_entry_vehicle* vehicleEntry)
 {
     uint16_t otherVehicleIndex = SPRITE_INDEX_NULL;
+    TrackGraphCursor trackPiece;
     TileElement* tileElement = nullptr;
     CoordsXYZ trackPos;
 
-    _vehicleUnkF64E10 = 1;
+    motion.UnkF64E10 = 1;
     acceleration = dword_9A2970[vehicle_sprite_type];
-    remaining_distance = _vehicleVelocityF64E0C + remaining_distance;
+    remaining_distance = motion.VelocityF64E0C + remaining_distance;
     if (remaining_distance >= 0 && remaining_distance < 0x368A)
     {
         goto loc_6DCE02;
     }
     sound2_flags &= ~VEHICLE_SOUND2_FLAGS_LIFT_HILL;
-    unk_F64E20.x = x;
-    unk_F64E20.y = y;
-    unk_F64E20.z = z;
+    motion.UnkF64E20.x = x;
+    motion.UnkF64E20.y = y;
+    motion.UnkF64E20.z = z;
     Invalidate();
     if (remaining_distance < 0)
         goto loc_6DCA9A;
@@ -8741,25 +8792,25 @@ loc_6DC476:
 
     {
         uint16_t trackType = GetTrackType();
-        _vehicleVAngleEndF64E36 = TrackDefinitions[trackType].vangle_end;
-        _vehicleBankEndF64E37 = TrackDefinitions[trackType].bank_end;
-        tileElement = map_get_track_element_at_of_type_seq(TrackLocation, trackType, 0);
+        motion.VAngleEndF64E36 = TrackDefinitions[trackType].vangle_end;
+        motion.BankEndF64E37 = TrackDefinitions[trackType].bank_end;
+        trackPiece = track_graph_get_piece(ride, TrackLocation, trackType);
+        tileElement = trackPiece.Element.element;
     }
     int32_t direction;
     {
-        CoordsXYE output;
+        TrackGraphCursor output;
         int32_t outZ, outDirection;
-        CoordsXYE input = { TrackLocation, tileElement };
-        if (!track_block_get_next(&input, &output, &outZ, &outDirection))
+        if (!track_graph_get_next(trackPiece, &output, &outZ, &outDirection))
         {
             goto loc_6DC9BC;
         }
-        tileElement = output.element;
-        trackPos = { output.x, output.y, outZ };
+        tileElement = output.Element.element;
+        trackPos = { output.Element.x, output.Element.y, outZ };
         direction = outDirection;
     }
 
-    if (!loc_6DB38B(this, tileElement))
+    if (!loc_6DB38B(motion, this, tileElement))
     {
         goto loc_6DC9BC;
     }
@@ -8899,7 +8950,7 @@ loc_6DC743:
         remaining_distance = 0;
     }
 
-    unk_F64E20 = trackPos;
+    motion.UnkF64E20 = trackPos;
     sprite_direction = moveInfo->direction;
     bank_rotation = moveInfo->bank_rotation;
     vehicle_sprite_type = moveInfo->vehicle_sprite_type;
@@ -8914,9 +8965,9 @@ loc_6DC743:
         }
     }
 
-    if (this == _vehicleFrontVehicle)
+    if (this == motion.FrontVehicle)
     {
-        if (_vehicleVelocityF64E08 >= 0)
+        if (motion.VelocityF64E08 >= 0)
         {
             otherVehicleIndex = prev_vehicle_on_ride;
             vehicle_update_motion_collision_detection(this, trackPos.x, trackPos.y, trackPos.z, &otherVehicleIndex);
@@ -8937,12 +8988,12 @@ loc_6DC99A:
         goto loc_6DCDE4;
     }
     acceleration = dword_9A2970[vehicle_sprite_type];
-    _vehicleUnkF64E10++;
+    motion.UnkF64E10++;
     goto loc_6DC462;
 
 loc_6DC9BC:
-    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
-    _vehicleVelocityF64E0C -= remaining_distance + 1;
+    motion.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
+    motion.VelocityF64E0C -= remaining_distance + 1;
     remaining_distance = -1;
     goto loc_6DCD2B;
 
@@ -8955,14 +9006,15 @@ loc_6DCA9A:
 
     {
         uint16_t trackType = GetTrackType();
-        _vehicleVAngleEndF64E36 = TrackDefinitions[trackType].vangle_end;
-        _vehicleBankEndF64E37 = TrackDefinitions[trackType].bank_end;
+        motion.VAngleEndF64E36 = TrackDefinitions[trackType].vangle_end;
+        motion.BankEndF64E37 = TrackDefinitions[trackType].bank_end;
 
-        tileElement = map_get_track_element_at_of_type_seq(TrackLocation, trackType, 0);
+        trackPiece = track_graph_get_piece(ride, TrackLocation, trackType);
+        tileElement = trackPiece.Element.element;
     }
     {
         track_begin_end trackBeginEnd;
-        if (!track_block_get_previous({ TrackLocation, tileElement }, &trackBeginEnd))
+        if (!track_graph_get_previous(trackPiece, &trackBeginEnd, nullptr))
         {
             goto loc_6DC9BC;
         }
@@ -8971,7 +9023,7 @@ loc_6DCA9A:
         tileElement = trackBeginEnd.begin_element;
     }
 
-    if (!loc_6DB38B(this, tileElement))
+    if (!loc_6DB38B(motion, this, tileElement))
     {
         goto loc_6DCD4A;
     }
@@ -8995,9 +9047,9 @@ loc_6DCA9A:
         ClearUpdateFlag(VEHICLE_UPDATE_FLAG_ON_LIFT_HILL);
         if (next_vehicle_on_train == SPRITE_INDEX_NULL)
         {
-            if (_vehicleVelocityF64E08 < 0)
+            if (motion.VelocityF64E08 < 0)
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_8;
+                motion.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_8;
             }
         }
     }
@@ -9019,7 +9071,7 @@ loc_6DCC2C:
         remaining_distance = 0;
     }
 
-    unk_F64E20 = trackPos;
+    motion.UnkF64E20 = trackPos;
     sprite_direction = moveInfo->direction;
     bank_rotation = moveInfo->bank_rotation;
     vehicle_sprite_type = moveInfo->vehicle_sprite_type;
@@ -9034,9 +9086,9 @@ loc_6DCC2C:
         }
     }
 
-    if (this == _vehicleFrontVehicle)
+    if (this == motion.FrontVehicle)
     {
-        if (_vehicleVelocityF64E08 >= 0)
+        if (motion.VelocityF64E08 >= 0)
         {
             otherVehicleIndex = var_44;
             if (vehicle_update_motion_collision_detection(this, trackPos.x, trackPos.y, trackPos.z, &otherVehicleIndex))
@@ -9052,40 +9104,40 @@ loc_6DCD2B:
         goto loc_6DCDE4;
     }
     acceleration += dword_9A2970[vehicle_sprite_type];
-    _vehicleUnkF64E10++;
+    motion.UnkF64E10++;
     goto loc_6DCA9A;
 
 loc_6DCD4A:
-    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
-    _vehicleVelocityF64E0C -= remaining_distance - 0x368A;
+    motion.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
+    motion.VelocityF64E0C -= remaining_distance - 0x368A;
     remaining_distance = 0x368A;
     goto loc_6DC99A;
 
 loc_6DCD6B:
-    _vehicleVelocityF64E0C -= remaining_distance - 0x368A;
+    motion.VelocityF64E0C -= remaining_distance - 0x368A;
     remaining_distance = 0x368A;
     {
         Vehicle* vEBP = GET_VEHICLE(otherVehicleIndex);
-        Vehicle* vEDI = gCurrentVehicle;
+        Vehicle* vEDI = motion.CurrentVehicle;
         if (abs(vEDI->velocity - vEBP->velocity) > 0xE0000)
         {
             if (!(vehicleEntry->flags & VEHICLE_ENTRY_FLAG_BOAT_HIRE_COLLISION_DETECTION))
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_COLLISION;
+                motion.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_COLLISION;
             }
         }
         vEDI->velocity = vEBP->velocity >> 1;
         vEBP->velocity = vEDI->velocity >> 1;
     }
-    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_2;
+    motion.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_2;
     goto loc_6DC99A;
 
 loc_6DCDE4:
-    MoveTo(unk_F64E20);
+    MoveTo(motion.UnkF64E20);
     Invalidate();
 
 loc_6DCE02:
-    acceleration /= _vehicleUnkF64E10;
+    acceleration /= motion.UnkF64E10;
     if (TrackSubposition == VEHICLE_TRACK_SUBPOSITION_CHAIRLIFT_GOING_BACK)
     {
         return;
@@ -9096,17 +9148,17 @@ loc_6DCE02:
         {
             return;
         }
-        _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_3;
+        motion.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_3;
         if (trackType != TRACK_ELEM_END_STATION)
         {
             return;
         }
     }
-    if (this != gCurrentVehicle)
+    if (this != motion.CurrentVehicle)
     {
         return;
     }
-    if (_vehicleVelocityF64E08 < 0)
+    if (motion.VelocityF64E08 < 0)
     {
         if (track_progress > 11)
         {
@@ -9118,7 +9170,7 @@ loc_6DCE02:
         return;
     }
 
-    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
+    motion.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
 
     for (int32_t i = 0; i < MAX_STATIONS; i++)
     {
@@ -9130,7 +9182,7 @@ loc_6DCE02:
         {
             continue;
         }
-        _vehicleStationIndex = i;
+        motion.CurrentStation = i;
     }
 }
 
@@ -9154,7 +9206,7 @@ static constexpr int32_t GetAccelerationDecrease2(const int32_t velocity, const
     }
 }
 
-int32_t Vehicle::UpdateTrackMotionMiniGolf(int32_t* outStation)
+int32_t Vehicle::UpdateTrackMotionMiniGolf(VehicleMotionContext& motion, int32_t* outStation)
 {
     auto curRide = get_ride(ride);
     if (curRide == nullptr)
@@ -9163,21 +9215,21 @@ int32_t Vehicle::UpdateTrackMotionMiniGolf(int32_t* outStation)
     rct_ride_entry* rideEntry = GetRideEntry();
     rct_ride_entry_vehicle* vehicleEntry = Entry();
 
-    gCurrentVehicle = this;
-    _vehicleMotionTrackFlags = 0;
+    motion.CurrentVehicle = this;
+    motion.MotionTrackFlags = 0;
     velocity += acceleration;
-    _vehicleVelocityF64E08 = velocity;
-    _vehicleVelocityF64E0C = (velocity >> 10) * 42;
-    _vehicleFrontVehicle = _vehicleVelocityF64E08 < 0 ? TrainTail() : this;
+    motion.VelocityF64E08 = velocity;
+    motion.VelocityF64E0C = (velocity >> 10) * 42;
+    motion.FrontVehicle = motion.VelocityF64E08 < 0 ? TrainTail() : this;
 
-    for (Vehicle* vehicle = _vehicleFrontVehicle;;)
+    for (Vehicle* vehicle = motion.FrontVehicle;;)
     {
-        vehicle->UpdateTrackMotionMiniGolfVehicle(curRide, rideEntry, vehicleEntry);
+        vehicle->UpdateTrackMotionMiniGolfVehicle(motion, curRide, rideEntry, vehicleEntry);
         if (vehicle->HasUpdateFlag(VEHICLE_UPDATE_FLAG_ON_LIFT_HILL))
         {
-            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_ON_LIFT_HILL;
+            motion.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_ON_LIFT_HILL;
         }
-        if (_vehicleVelocityF64E08 >= 0)
+        if (motion.VelocityF64E08 >= 0)
         {
             if (vehicle->next_vehicle_on_train == SPRITE_INDEX_NULL)
             {
@@ -9187,7 +9239,7 @@ int32_t Vehicle::UpdateTrackMotionMiniGolf(int32_t* outStation)
         }
         else
         {
-            if (vehicle == gCurrentVehicle)
+            if (vehicle == motion.CurrentVehicle)
             {
                 break;
             }
@@ -9275,8 +9327,8 @@ loc_6DD069:
     acceleration = newAcceleration;
 
     if (outStation != nullptr)
-        *outStation = _vehicleStationIndex;
-    return _vehicleMotionTrackFlags;
+        *outStation = motion.CurrentStation;
+    return motion.MotionTrackFlags;
 }
 
 /**
@@ -9390,7 +9442,7 @@ int32_t Vehicle::UpdateTrackMotionPoweredRideAcceleration(
  *
  *  rct2: 0x006DAB4C
  */
-int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
+int32_t Vehicle::UpdateTrackMotion(VehicleMotionContext& motion, int32_t* outStation)
 {
     registers regs = {};
 
@@ -9408,26 +9460,26 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
 
     if (vehicleEntry->flags & VEHICLE_ENTRY_FLAG_MINI_GOLF)
     {
-        return UpdateTrackMotionMiniGolf(outStation);
+        return UpdateTrackMotionMiniGolf(motion, outStation);
     }
 
-    _vehicleF64E2C = 0;
-    gCurrentVehicle = this;
-    _vehicleMotionTrackFlags = 0;
-    _vehicleStationIndex = STATION_INDEX_NULL;
+    motion.F64E2C = 0;
+    motion.CurrentVehicle = this;
+    motion.MotionTrackFlags = 0;
+    motion.CurrentStation = STATION_INDEX_NULL;
 
-    UpdateTrackMotionUpStopCheck();
-    CheckAndApplyBlockSectionStopSite();
-    UpdateVelocity();
+    UpdateTrackMotionUpStopCheck(motion);
+    CheckAndApplyBlockSectionStopSite(motion);
+    UpdateVelocity(motion);
 
     Vehicle* vehicle = this;
-    if (_vehicleVelocityF64E08 < 0)
+    if (motion.VelocityF64E08 < 0)
     {
         vehicle = vehicle->TrainTail();
     }
     // This will be the front vehicle even when traveling
     // backwards.
-    _vehicleFrontVehicle = vehicle;
+    motion.FrontVehicle = vehicle;
 
     uint16_t spriteId = vehicle->sprite_index;
     while (spriteId != SPRITE_INDEX_NULL)
@@ -9442,28 +9494,28 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
         // Swinging cars
         if (vehicleEntry->flags & VEHICLE_ENTRY_FLAG_SWINGING)
         {
-            car->UpdateSwingingCar();
+            car->UpdateSwingingCar(motion);
         }
         // Spinning cars
         if (vehicleEntry->flags & VEHICLE_ENTRY_FLAG_SPINNING)
         {
-            car->UpdateSpinningCar();
+            car->UpdateSpinningCar(motion);
         }
         // Rider sprites?? animation??
         if ((vehicleEntry->flags & VEHICLE_ENTRY_FLAG_VEHICLE_ANIMATION)
             || (vehicleEntry->flags & VEHICLE_ENTRY_FLAG_RIDER_ANIMATION))
         {
-            car->UpdateAdditionalAnimation();
+            car->UpdateAdditionalAnimation(motion);
         }
         car->acceleration = dword_9A2970[car->vehicle_sprite_type];
-        _vehicleUnkF64E10 = 1;
+        motion.UnkF64E10 = 1;
 
-        car->remaining_distance += _vehicleVelocityF64E0C;
+        car->remaining_distance += motion.VelocityF64E0C;
 
         car->sound2_flags &= ~VEHICLE_SOUND2_FLAGS_LIFT_HILL;
-        unk_F64E20.x = car->x;
-        unk_F64E20.y = car->y;
-        unk_F64E20.z = car->z;
+        motion.UnkF64E20.x = car->x;
+        motion.UnkF64E20.y = car->y;
+        motion.UnkF64E20.z = car->z;
         car->Invalidate();
 
         while (true)
@@ -9471,7 +9523,7 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
             if (car->remaining_distance < 0)
             {
                 // Backward loop
-                if (car->UpdateTrackMotionBackwards(vehicleEntry, curRide, rideEntry))
+                if (car->UpdateTrackMotionBackwards(motion, vehicleEntry, curRide, rideEntry))
                 {
                     break;
                 }
@@ -9483,7 +9535,7 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
                     }
                     regs.ebx = dword_9A2970[car->vehicle_sprite_type];
                     car->acceleration += regs.ebx;
-                    _vehicleUnkF64E10++;
+                    motion.UnkF64E10++;
                     continue;
                 }
             }
@@ -9492,7 +9544,7 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
                 // Location found
                 goto loc_6DBF3E;
             }
-            if (car->UpdateTrackMotionForwards(vehicleEntry, curRide, rideEntry))
+            if (car->UpdateTrackMotionForwards(motion, vehicleEntry, curRide, rideEntry))
             {
                 break;
             }
@@ -9504,29 +9556,29 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
                 }
                 regs.ebx = dword_9A2970[car->vehicle_sprite_type];
                 car->acceleration = regs.ebx;
-                _vehicleUnkF64E10++;
+                motion.UnkF64E10++;
                 continue;
             }
         }
         // loc_6DBF20
-        car->MoveTo(unk_F64E20);
+        car->MoveTo(motion.UnkF64E20);
         car->Invalidate();
 
     loc_6DBF3E:
-        sub_6DBF3E(car);
+        sub_6DBF3E(motion, car);
 
         // loc_6DC0F7
         if (car->HasUpdateFlag(VEHICLE_UPDATE_FLAG_ON_LIFT_HILL))
         {
-            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_ON_LIFT_HILL;
+            motion.MotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_ON_LIFT_HILL;
         }
-        if (_vehicleVelocityF64E08 >= 0)
+        if (motion.VelocityF64E08 >= 0)
         {
             spriteId = car->next_vehicle_on_train;
         }
         else
         {
-            if (car == gCurrentVehicle)
+            if (car == motion.CurrentVehicle)
             {
                 break;
             }
@@ -9534,7 +9586,7 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
         }
     }
     // loc_6DC144
-    vehicle = gCurrentVehicle;
+    vehicle = motion.CurrentVehicle;
 
     vehicleEntry = vehicle->Entry();
     // eax
@@ -9562,7 +9614,7 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
         vehicle = GET_VEHICLE(spriteIndex);
     }
 
-    vehicle = gCurrentVehicle;
+    vehicle = motion.CurrentVehicle;
     int32_t newAcceleration = (totalAcceleration / numVehicles) * 21;
     if (newAcceleration < 0)
     {
@@ -9626,8 +9678,8 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
 
     // hook_setreturnregisters(&regs);
     if (outStation != nullptr)
-        *outStation = _vehicleStationIndex;
-    return _vehicleMotionTrackFlags;
+        *outStation = motion.CurrentStation;
+    return motion.MotionTrackFlags;
 }
 
 rct_ride_entry* Vehicle::GetRideEntry() const
@@ -9699,9 +9751,9 @@ void Vehicle::UpdateCrossings() const
     track_begin_end output;
     int32_t direction;
 
-    CoordsXYE xyElement = { frontVehicle->TrackLocation,
-                            map_get_track_element_at_of_type_seq(
-                                frontVehicle->TrackLocation, frontVehicle->GetTrackType(), 0) };
+    TrackGraphCursor trackPiece = track_graph_get_piece(
+        frontVehicle->ride, frontVehicle->TrackLocation, frontVehicle->GetTrackType());
+    CoordsXYE& xyElement = trackPiece.Element;
     int32_t curZ = frontVehicle->TrackLocation.z;
 
     if (xyElement.element && status != VEHICLE_STATUS_ARRIVING)
@@ -9748,20 +9800,19 @@ void Vehicle::UpdateCrossings() const
 
             if (travellingForwards)
             {
-                if (!track_block_get_next(&xyElement, &xyElement, &curZ, &direction))
+                if (!track_graph_get_next(trackPiece, &trackPiece, &curZ, &direction))
                 {
                     break;
                 }
             }
             else
             {
-                if (!track_block_get_previous(xyElement, &output))
+                uint32_t previousPiece;
+                if (!track_graph_get_previous(trackPiece, &output, &previousPiece))
                 {
                     break;
                 }
-                xyElement.x = output.begin_x;
-                xyElement.y = output.begin_y;
-                xyElement.element = output.begin_element;
+                trackPiece = { { output.begin_x, output.begin_y, output.begin_element }, previousPiece };
             }
 
             if (xyElement.element->AsTrack()->IsStation())
@@ -9771,8 +9822,7 @@ void Vehicle::UpdateCrossings() const
         }
     }
 
-    xyElement = { backVehicle->TrackLocation,
-                  map_get_track_element_at_of_type_seq(backVehicle->TrackLocation, backVehicle->GetTrackType(), 0) };
+    trackPiece = track_graph_get_piece(backVehicle->ride, backVehicle->TrackLocation, backVehicle->GetTrackType());
     curZ = backVehicle->TrackLocation.z;
 
     if (xyElement.element)
@@ -9783,11 +9833,10 @@ void Vehicle::UpdateCrossings() const
         {
             if (travellingForwards)
             {
-                if (track_block_get_previous(xyElement, &output))
+                uint32_t previousPiece;
+                if (track_graph_get_previous(trackPiece, &output, &previousPiece))
                 {
-                    xyElement.x = output.begin_x;
-                    xyElement.y = output.begin_y;
-                    xyElement.element = output.begin_element;
+                    trackPiece = { { output.begin_x, output.begin_y, output.begin_element }, previousPiece };
                 }
             }
 
@@ -198,6 +198,28 @@ struct rct_vehicle_info
     uint8_t bank_rotation;       // 0x08
 };
 
+struct Vehicle;
+
+/**
+ * Scratch state shared between the motion functions while one train is being updated. Each update gets its own, so
+ * nothing carries over from one train to the next.
+ */
+struct VehicleMotionContext
+{
+    Vehicle* CurrentVehicle = nullptr;
+    Vehicle* FrontVehicle = nullptr;
+    StationIndex CurrentStation = 0;
+    uint8_t Breakdown = 0;
+    uint32_t MotionTrackFlags = 0;
+    int32_t VelocityF64E08 = 0;
+    int32_t VelocityF64E0C = 0;
+    int32_t UnkF64E10 = 0;
+    uint8_t VAngleEndF64E36 = 0;
+    uint8_t BankEndF64E37 = 0;
+    uint8_t F64E2C = 0;
+    CoordsXYZ UnkF64E20;
+};
+
 struct Vehicle : SpriteBase
 {
     uint8_t vehicle_sprite_type;
@@ -316,7 +338,7 @@ struct Vehicle : SpriteBase
     {
         return type == VEHICLE_TYPE_HEAD;
     }
-    void Update();
+    void Update(VehicleMotionContext& motion);
     Vehicle* GetHead();
     const Vehicle* GetHead() const;
     const Vehicle* GetCar(size_t carIndex) const;
@@ -325,8 +347,8 @@ struct Vehicle : SpriteBase
     bool IsGhost() const;
     void UpdateSoundParams(std::vector<rct_vehicle_sound_params>& vehicleSoundParamsList) const;
     bool DodgemsCarWouldCollideAt(const CoordsXY& coords, uint16_t* spriteId) const;
-    int32_t UpdateTrackMotion(int32_t* outStation);
-    int32_t CableLiftUpdateTrackMotion();
+    int32_t UpdateTrackMotion(VehicleMotionContext& motion, int32_t* outStation);
+    int32_t CableLiftUpdateTrackMotion(VehicleMotionContext& motion);
     GForces GetGForces() const;
     void SetMapToolbar() const;
     int32_t IsUsedInPairs() const;
@@ -359,56 +381,59 @@ private:
     const rct_vehicle_info* GetMoveInfo() const;
     uint16_t GetTrackProgress() const;
     rct_vehicle_sound_params CreateSoundParam(uint16_t priority) const;
-    void CableLiftUpdate();
-    bool CableLiftUpdateTrackMotionForwards();
-    bool CableLiftUpdateTrackMotionBackwards();
-    void CableLiftUpdateMovingToEndOfStation();
-    void CableLiftUpdateWaitingToDepart();
+    void CableLiftUpdate(VehicleMotionContext& motion);
+    bool CableLiftUpdateTrackMotionForwards(VehicleMotionContext& motion);
+    bool CableLiftUpdateTrackMotionBackwards(VehicleMotionContext& motion);
+    void CableLiftUpdateMovingToEndOfStation(VehicleMotionContext& motion);
+    void CableLiftUpdateWaitingToDepart(VehicleMotionContext& motion);
     void CableLiftUpdateDeparting();
-    void CableLiftUpdateTravelling();
+    void CableLiftUpdateTravelling(VehicleMotionContext& motion);
     void CableLiftUpdateArriving();
     void UpdateMeasurements();
-    void UpdateMovingToEndOfStation();
+    void UpdateMovingToEndOfStation(VehicleMotionContext& motion);
     void UpdateWaitingForPassengers();
-    void UpdateWaitingToDepart();
+    void UpdateWaitingToDepart(VehicleMotionContext& motion);
     void UpdateCrash();
-    void UpdateDodgemsMode();
+    void UpdateDodgemsMode(VehicleMotionContext& motion);
     void UpdateSwinging();
-    void UpdateSimulatorOperating();
-    void UpdateTopSpinOperating();
-    void UpdateFerrisWheelRotating();
-    void UpdateSpaceRingsOperating();
-    void UpdateHauntedHouseOperating();
-    void UpdateCrookedHouseOperating();
-    void UpdateRotating();
-    void UpdateDeparting();
+    void UpdateSimulatorOperating(VehicleMotionContext& motion);
+    void UpdateTopSpinOperating(VehicleMotionContext& motion);
+    void UpdateFerrisWheelRotating(VehicleMotionContext& motion);
+    void UpdateSpaceRingsOperating(VehicleMotionContext& motion);
+    void UpdateHauntedHouseOperating(VehicleMotionContext& motion);
+    void UpdateCrookedHouseOperating(VehicleMotionContext& motion);
+    void UpdateRotating(VehicleMotionContext& motion);
+    void UpdateDeparting(VehicleMotionContext& motion);
     void FinishDeparting();
-    void UpdateTravelling();
-    void UpdateTravellingCableLift();
-    void UpdateTravellingBoat();
-    void UpdateMotionBoatHire();
-    void TryReconnectBoatToTrack(const CoordsXY& currentBoatLocation, const CoordsXY& trackCoords);
-    void UpdateDepartingBoatHire();
-    void UpdateTravellingBoatHireSetup();
+    void UpdateTravelling(VehicleMotionContext& motion);
+    void UpdateTravellingCableLift(VehicleMotionContext& motion);
+    void UpdateTravellingBoat(VehicleMotionContext& motion);
+    void UpdateMotionBoatHire(VehicleMotionContext& motion);
+    void TryReconnectBoatToTrack(
+        VehicleMotionContext& motion, const CoordsXY& currentBoatLocation, const CoordsXY& trackCoords);
+    void UpdateDepartingBoatHire(VehicleMotionContext& motion);
+    void UpdateTravellingBoatHireSetup(VehicleMotionContext& motion);
     void UpdateBoatLocation();
-    void UpdateArriving();
+    void UpdateArriving(VehicleMotionContext& motion);
     void UpdateUnloadingPassengers();
     void UpdateWaitingForCableLift();
-    void UpdateShowingFilm();
-    void UpdateDoingCircusShow();
+    void UpdateShowingFilm(VehicleMotionContext& motion);
+    void UpdateDoingCircusShow(VehicleMotionContext& motion);
     void UpdateCrossings() const;
     void UpdateSound();
     SoundId UpdateScreamSound();
     void UpdateCrashSetup();
     void UpdateCollisionSetup();
-    int32_t UpdateMotionDodgems();
-    void UpdateAdditionalAnimation();
+    int32_t UpdateMotionDodgems(VehicleMotionContext& motion);
+    void UpdateAdditionalAnimation(VehicleMotionContext& motion);
     void CheckIfMissing();
     bool CurrentTowerElementIsTop();
-    bool UpdateTrackMotionForwards(rct_ride_entry_vehicle* vehicleEntry, Ride* curRide, rct_ride_entry* rideEntry);
-    bool UpdateTrackMotionBackwards(rct_ride_entry_vehicle* vehicleEntry, Ride* curRide, rct_ride_entry* rideEntry);
+    bool UpdateTrackMotionForwards(
+        VehicleMotionContext& motion, rct_ride_entry_vehicle* vehicleEntry, Ride* curRide, rct_ride_entry* rideEntry);
+    bool UpdateTrackMotionBackwards(
+        VehicleMotionContext& motion, rct_ride_entry_vehicle* vehicleEntry, Ride* curRide, rct_ride_entry* rideEntry);
     bool VehicleColision(
-        Vehicle* currentVehicle, Vehicle* otherVehicle, rct_ride_entry_vehicle* vehicleEntry,
+        VehicleMotionContext& motion, Vehicle* currentVehicle, Vehicle* otherVehicle, rct_ride_entry_vehicle* vehicleEntry,
         rct_ride_entry* rideEntry, uint32_t MotionTrackFlag);
     int32_t UpdateTrackMotionPoweredRideAcceleration(
         rct_ride_entry_vehicle* vehicleEntry, uint32_t totalMass, const int32_t curAcceleration);
@@ -420,15 +445,15 @@ private:
     bool CanDepartSynchronised() const;
     void ReverseReverserCar();
     void UpdateReverserCarBogies();
-    void UpdateHandleWaterSplash() const;
+    void UpdateHandleWaterSplash(VehicleMotionContext& motion) const;
     void Claxon() const;
-    void UpdateTrackMotionUpStopCheck() const;
+    void UpdateTrackMotionUpStopCheck(VehicleMotionContext& motion) const;
     void ApplyNonStopBlockBrake();
-    void ApplyStopBlockBrake();
-    void CheckAndApplyBlockSectionStopSite();
-    void UpdateVelocity();
-    void UpdateSpinningCar();
-    void UpdateSwingingCar();
+    void ApplyStopBlockBrake(VehicleMotionContext& motion);
+    void CheckAndApplyBlockSectionStopSite(VehicleMotionContext& motion);
+    void UpdateVelocity(VehicleMotionContext& motion);
+    void UpdateSpinningCar(VehicleMotionContext& motion);
+    void UpdateSwingingCar(VehicleMotionContext& motion);
     int32_t GetSwingAmount() const;
     bool OpenRestraints();
     bool CloseRestraints();
@@ -438,10 +463,13 @@ private:
     void KillAllPassengersInTrain();
     void KillPassengers(Ride* curRide);
     void TrainReadyToDepart(uint8_t num_peeps_on_train, uint8_t num_used_seats);
-    int32_t UpdateTrackMotionMiniGolf(int32_t* outStation);
-    void UpdateTrackMotionMiniGolfVehicle(Ride* curRide, rct_ride_entry* rideEntry, rct_ride_entry_vehicle* vehicleEntry);
-    bool UpdateTrackMotionForwardsGetNewTrack(uint16_t trackType, Ride* curRide, rct_ride_entry* rideEntry);
-    bool UpdateTrackMotionBackwardsGetNewTrack(uint16_t trackType, Ride* curRide, uint16_t* progress);
+    int32_t UpdateTrackMotionMiniGolf(VehicleMotionContext& motion, int32_t* outStation);
+    void UpdateTrackMotionMiniGolfVehicle(
+        VehicleMotionContext& motion, Ride* curRide, rct_ride_entry* rideEntry, rct_ride_entry_vehicle* vehicleEntry);
+    bool UpdateTrackMotionForwardsGetNewTrack(
+        VehicleMotionContext& motion, uint16_t trackType, Ride* curRide, rct_ride_entry* rideEntry);
+    bool UpdateTrackMotionBackwardsGetNewTrack(
+        VehicleMotionContext& motion, uint16_t trackType, Ride* curRide, uint16_t* progress);
     void UpdateGoKartAttemptSwitchLanes();
     void UpdateSceneryDoor() const;
     void UpdateSceneryDoorBackwards() const;
@@ -624,18 +652,6 @@ Vehicle* try_get_vehicle(uint16_t spriteIndex);
 void vehicle_update_all();
 void vehicle_sounds_update();
 
-extern Vehicle* gCurrentVehicle;
-extern StationIndex _vehicleStationIndex;
-extern uint32_t _vehicleMotionTrackFlags;
-extern int32_t _vehicleVelocityF64E08;
-extern int32_t _vehicleVelocityF64E0C;
-extern int32_t _vehicleUnkF64E10;
-extern uint8_t _vehicleVAngleEndF64E36;
-extern uint8_t _vehicleBankEndF64E37;
-extern uint8_t _vehicleF64E2C;
-extern Vehicle* _vehicleFrontVehicle;
-extern CoordsXYZ unk_F64E20;
-
 /** Helper macro until rides are stored in this module. */
 #define GET_VEHICLE(sprite_index) &(get_sprite(sprite_index)->vehicle)
 
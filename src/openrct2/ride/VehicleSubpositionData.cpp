@@ -25744,4 +25744,54 @@ constexpr const rct_vehicle_info_list * const * gTrackVehicleInfo[VEHICLE_TRACK_
     TrackVehicleInfoListReverserRCRearBogie,      // VEHICLE_TRACK_SUBPOSITION_REVERSER_RC_REAR_BOGIE
 };
 
+static constexpr const uint16_t TrackVehicleInfoListCounts[VEHICLE_TRACK_SUBPOSITION_COUNT] = {
+    static_cast<uint16_t>(std::size(TrackVehicleInfoListDefault)),
+    static_cast<uint16_t>(std::size(TrackVehicleInfoListChairliftGoingOut)),
+    static_cast<uint16_t>(std::size(TrackVehicleInfoListChairliftGoingBack)),
+    static_cast<uint16_t>(std::size(TrackVehicleInfoListChairliftEndBullwheel)),
+    static_cast<uint16_t>(std::size(TrackVehicleInfoListChairliftStartBullwheel)),
+    static_cast<uint16_t>(std::size(TrackVehicleInfoListGoKartsLeftLane)),
+    static_cast<uint16_t>(std::size(TrackVehicleInfoListGoKartsRightLane)),
+    static_cast<uint16_t>(std::size(TrackVehicleInfoListGoKartsMovingToRightLane)),
+    static_cast<uint16_t>(std::size(TrackVehicleInfoListGoKartsMovingToLeftLane)),
+    static_cast<uint16_t>(std::size(TrackVehicleInfoListMiniGolfStartPathA9)),
+    static_cast<uint16_t>(std::size(TrackVehicleInfoListMiniGolfBallPathA10)),
+    static_cast<uint16_t>(std::size(TrackVehicleInfoListMiniGolfPathB11)),
+    static_cast<uint16_t>(std::size(TrackVehicleInfoListMiniGolfBallPathB12)),
+    static_cast<uint16_t>(std::size(TrackVehicleInfoListMiniGolfPathC13)),
+    static_cast<uint16_t>(std::size(TrackVehicleInfoListMiniGolfPathC14)),
+    static_cast<uint16_t>(std::size(TrackVehicleInfoListReverserRCFrontBogie)),
+    static_cast<uint16_t>(std::size(TrackVehicleInfoListReverserRCRearBogie)),
+};
+
 // clang-format on
+
+static constexpr size_t GetTrackVehicleInfoListCount()
+{
+    size_t count = 0;
+    for (auto subpositionCount : TrackVehicleInfoListCounts)
+    {
+        count += subpositionCount;
+    }
+    return count;
+}
+static_assert(GetTrackVehicleInfoListCount() == TRACK_VEHICLE_INFO_LIST_COUNT);
+
+static constexpr TrackVehicleInfoTable CreateTrackVehicleInfoTable()
+{
+    TrackVehicleInfoTable table{};
+    uint16_t start = 0;
+    for (size_t i = 0; i < VEHICLE_TRACK_SUBPOSITION_COUNT; i++)
+    {
+        table.Start[i] = start;
+        table.Count[i] = TrackVehicleInfoListCounts[i];
+        for (size_t j = 0; j < TrackVehicleInfoListCounts[i]; j++)
+        {
+            table.Lists[start + j] = *gTrackVehicleInfo[i][j];
+        }
+        start += TrackVehicleInfoListCounts[i];
+    }
+    return table;
+}
+
+constexpr const TrackVehicleInfoTable gTrackVehicleInfoTable = CreateTrackVehicleInfoTable();
@@ -11,6 +11,7 @@
 
 #include "Vehicle.h"
 
+#include <cstddef>
 #include <cstdint>
 
 struct rct_vehicle_info_list
@@ -20,3 +21,31 @@ struct rct_vehicle_info_list
 };
 
 extern const rct_vehicle_info_list* const* const gTrackVehicleInfo[17];
+
+constexpr const size_t TRACK_VEHICLE_INFO_LIST_COUNT = 10440;
+
+/**
+ * All the lists of gTrackVehicleInfo copied into one array, so that finding the list for a subposition, track type and
+ * direction is a single indexed load instead of following two pointers.
+ */
+struct TrackVehicleInfoTable
+{
+    uint16_t Start[VEHICLE_TRACK_SUBPOSITION_COUNT];
+    uint16_t Count[VEHICLE_TRACK_SUBPOSITION_COUNT];
+    rct_vehicle_info_list Lists[TRACK_VEHICLE_INFO_LIST_COUNT];
+};
+
+extern const TrackVehicleInfoTable gTrackVehicleInfoTable;
+
+/**
+ * Returns the list of vehicle positions for the given subposition and track type and direction (track type * 4 +
+ * direction), or nullptr if there is none.
+ */
+inline const rct_vehicle_info_list* track_vehicle_info_get_list(int32_t trackSubposition, int32_t typeAndDirection)
+{
+    if (static_cast<uint32_t>(trackSubposition) >= VEHICLE_TRACK_SUBPOSITION_COUNT)
+        return nullptr;
+    if (static_cast<uint32_t>(typeAndDirection) >= gTrackVehicleInfoTable.Count[trackSubposition])
+        return nullptr;
+    return &gTrackVehicleInfoTable.Lists[gTrackVehicleInfoTable.Start[trackSubposition] + typeAndDirection];
+}
@@ -14,6 +14,7 @@
 #    include "../Context.h"
 #    include "../common.h"
 #    include "../core/Guard.hpp"
+#    include "../ride/TrackGraph.h"
 #    include "../world/Footpath.h"
 #    include "../world/Scenery.h"
 #    include "../world/Sprite.h"
@@ -945,6 +946,7 @@ namespace OpenRCT2::Scripting
         void Invalidate()
         {
             map_invalidate_tile_full(_coords);
+            track_graph_invalidate();
         }
 
     public:
@@ -40,6 +40,7 @@
 #include "../ride/Track.h"
 #include "../ride/TrackData.h"
 #include "../ride/TrackDesign.h"
+#include "../ride/TrackGraph.h"
 #include "../scenario/Scenario.h"
 #include "../util/Util.h"
 #include "../windows/Intent.h"
@@ -375,6 +376,7 @@ void map_strip_ghost_flag_from_elements()
     {
         element.SetGhost(false);
     }
+    track_graph_invalidate();
 }
 
 /**
@@ -403,6 +405,8 @@ void map_update_tile_pointers()
     }
 
     gNextFreeTileElement = tileElement;
+
+    track_graph_invalidate();
 }
 
 /**
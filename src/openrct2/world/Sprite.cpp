@@ -23,7 +23,9 @@
 
 #include <algorithm>
 #include <cmath>
+#include <functional>
 #include <iterator>
+#include <vector>
 
 uint16_t gSpriteListHead[SPRITE_LIST_COUNT];
 uint16_t gSpriteListCount[SPRITE_LIST_COUNT];
@@ -33,6 +35,37 @@ static bool _spriteFlashingList[MAX_SPRITES];
 
 uint16_t gSpriteSpatialIndex[SPATIAL_INDEX_SIZE];
 
+// Compact per tile lists of sprite indices, one for each sprite identifier, kept in the same descending sprite index order
+// as the next_in_quadrant lists. These let tile queries for one kind of entity skip over all the others. The lists of a
+// tile are stored back to back in one block of a shared pool, tiles without sprites have no block.
+struct SpriteSpatialGridTile
+{
+    uint32_t Offset = 0;
+    uint16_t Capacity = 0;
+    uint16_t Counts[SPATIAL_GRID_IDENTIFIER_COUNT] = {};
+};
+
+constexpr uint16_t SPATIAL_GRID_MIN_BLOCK_CAPACITY = 4;
+constexpr size_t SPATIAL_GRID_BLOCK_CLASS_COUNT = 13;
+static_assert(
+    (SPATIAL_GRID_MIN_BLOCK_CAPACITY << (SPATIAL_GRID_BLOCK_CLASS_COUNT - 1)) >= MAX_SPRITES,
+    "Largest spatial grid block must fit every sprite");
+
+static SpriteSpatialGridTile _spriteSpatialGrid[SPATIAL_INDEX_SIZE];
+static std::vector<uint16_t> _spriteSpatialGridPool;
+
+// Blocks that no tile uses any more, by size class. A block of class n holds SPATIAL_GRID_MIN_BLOCK_CAPACITY << n entries.
+static std::vector<uint32_t> _spriteSpatialGridFreeBlocks[SPATIAL_GRID_BLOCK_CLASS_COUNT];
+
+struct SpriteSpatialGridEntry
+{
+    uint32_t Index = SPATIAL_INDEX_LOCATION_NULL;
+    uint8_t Identifier = SPRITE_IDENTIFIER_NULL;
+};
+
+// Where each sprite is listed in the spatial grid, so it can be removed even after its position or identifier changed.
+static SpriteSpatialGridEntry _spriteSpatialGridEntries[MAX_SPRITES];
+
 const rct_string_id litterNames[12] = { STR_LITTER_VOMIT,
                                         STR_LITTER_VOMIT,
                                         STR_SHOP_ITEM_SINGULAR_EMPTY_CAN,
@@ -50,6 +83,8 @@ static CoordsXYZ _spritelocations1[MAX_SPRITES];
 static CoordsXYZ _spritelocations2[MAX_SPRITES];
 
 static size_t GetSpatialIndexOffset(int32_t x, int32_t y);
+static void SpriteSpatialGridInsert(SpriteBase* sprite, size_t index);
+static void SpriteSpatialGridRemove(SpriteBase* sprite);
 static void move_sprite_to_list(SpriteBase* sprite, SPRITE_LIST newListIndex);
 
 // Required for GetEntity to return a default
@@ -127,6 +162,38 @@ uint16_t sprite_get_first_in_quadrant(int32_t x, int32_t y)
     return gSpriteSpatialIndex[GetSpatialIndexOffset(x, y)];
 }
 
+static uint16_t SpriteSpatialGridGetListStart(const SpriteSpatialGridTile& tile, uint8_t spriteIdentifier)
+{
+    uint16_t start = 0;
+    for (uint8_t i = 0; i < spriteIdentifier; i++)
+    {
+        start += tile.Counts[i];
+    }
+    return start;
+}
+
+static uint16_t SpriteSpatialGridGetTileCount(const SpriteSpatialGridTile& tile)
+{
+    return SpriteSpatialGridGetListStart(tile, SPATIAL_GRID_IDENTIFIER_COUNT);
+}
+
+uint16_t sprite_get_spatial_grid_next(const CoordsXY& loc, SPRITE_IDENTIFIER spriteIdentifier, uint16_t spriteIndex)
+{
+    if (spriteIdentifier >= SPATIAL_GRID_IDENTIFIER_COUNT)
+        return SPRITE_INDEX_NULL;
+
+    const auto& tile = _spriteSpatialGrid[GetSpatialIndexOffset(loc.x, loc.y)];
+    if (tile.Counts[spriteIdentifier] == 0)
+        return SPRITE_INDEX_NULL;
+
+    const uint16_t* entities = _spriteSpatialGridPool.data() + tile.Offset;
+    const uint16_t* begin = entities + SpriteSpatialGridGetListStart(tile, spriteIdentifier);
+    const uint16_t* end = begin + tile.Counts[spriteIdentifier];
+    // Entities are listed in descending sprite index order, the next one is the first with a lower index.
+    auto it = std::upper_bound(begin, end, spriteIndex, std::greater<uint16_t>());
+    return it != end ? *it : SPRITE_INDEX_NULL;
+}
+
 static void invalidate_sprite_max_zoom(SpriteBase* sprite, int32_t maxZoom)
 {
     if (sprite->sprite_left == LOCATION_NULL)
@@ -234,6 +301,31 @@ void reset_sprite_spatial_index()
             spr->next_in_quadrant = nextSpriteId;
         }
     }
+    reset_sprite_spatial_grid();
+}
+
+/**
+ * Rebuilds the spatial grid from the positions of all sprites, without touching the next_in_quadrant lists.
+ */
+void reset_sprite_spatial_grid()
+{
+    std::fill(std::begin(_spriteSpatialGrid), std::end(_spriteSpatialGrid), SpriteSpatialGridTile{});
+    _spriteSpatialGridPool.clear();
+    for (auto& freeBlocks : _spriteSpatialGridFreeBlocks)
+    {
+        freeBlocks.clear();
+    }
+
+    // Walking the sprites backwards only ever appends to the lists.
+    for (size_t i = MAX_SPRITES; i-- > 0;)
+    {
+        _spriteSpatialGridEntries[i] = {};
+        auto* spr = GetEntity(i);
+        if (spr->sprite_identifier != SPRITE_IDENTIFIER_NULL)
+        {
+            SpriteSpatialGridInsert(spr, GetSpatialIndexOffset(spr->x, spr->y));
+        }
+    }
 }
 
 static size_t GetSpatialIndexOffset(int32_t x, int32_t y)
@@ -406,6 +498,7 @@ rct_sprite* create_sprite(SPRITE_IDENTIFIER spriteIdentifier, SPRITE_LIST linked
     // may contain garbage and cause a desync later on.
     sprite_reset(sprite);
 
+    sprite->sprite_identifier = spriteIdentifier;
     sprite->x = LOCATION_NULL;
     sprite->y = LOCATION_NULL;
     sprite->z = 0;
@@ -649,6 +742,8 @@ static void SpriteSpatialInsert(SpriteBase* sprite, const CoordsXY& newLoc)
 
     sprite->next_in_quadrant = *next;
     *next = sprite->sprite_index;
+
+    SpriteSpatialGridInsert(sprite, newIndex);
 }
 
 static void SpriteSpatialRemove(SpriteBase* sprite)
@@ -674,6 +769,103 @@ static void SpriteSpatialRemove(SpriteBase* sprite)
         sprite2 = GetEntity(*index);
     }
     *index = sprite->next_in_quadrant;
+
+    SpriteSpatialGridRemove(sprite);
+}
+
+static size_t SpriteSpatialGridGetBlockClass(uint16_t capacity)
+{
+    size_t blockClass = 0;
+    while ((SPATIAL_GRID_MIN_BLOCK_CAPACITY << blockClass) < capacity)
+    {
+        blockClass++;
+    }
+    return blockClass;
+}
+
+static uint32_t SpriteSpatialGridAllocateBlock(uint16_t capacity)
+{
+    auto& freeBlocks = _spriteSpatialGridFreeBlocks[SpriteSpatialGridGetBlockClass(capacity)];
+    if (!freeBlocks.empty())
+    {
+        auto offset = freeBlocks.back();
+        freeBlocks.pop_back();
+        return offset;
+    }
+
+    auto offset = static_cast<uint32_t>(_spriteSpatialGridPool.size());
+    _spriteSpatialGridPool.resize(_spriteSpatialGridPool.size() + capacity);
+    return offset;
+}
+
+static void SpriteSpatialGridFreeBlock(SpriteSpatialGridTile& tile)
+{
+    if (tile.Capacity != 0)
+    {
+        _spriteSpatialGridFreeBlocks[SpriteSpatialGridGetBlockClass(tile.Capacity)].push_back(tile.Offset);
+        tile.Offset = 0;
+        tile.Capacity = 0;
+    }
+}
+
+static void SpriteSpatialGridInsert(SpriteBase* sprite, size_t index)
+{
+    auto& entry = _spriteSpatialGridEntries[sprite->sprite_index];
+    if (sprite->sprite_identifier >= SPATIAL_GRID_IDENTIFIER_COUNT)
+    {
+        entry = {};
+        return;
+    }
+
+    auto& tile = _spriteSpatialGrid[index];
+    auto count = SpriteSpatialGridGetTileCount(tile);
+    if (count == tile.Capacity)
+    {
+        // Move the lists to a block twice the size.
+        uint16_t capacity = tile.Capacity == 0 ? SPATIAL_GRID_MIN_BLOCK_CAPACITY : tile.Capacity * 2;
+        auto offset = SpriteSpatialGridAllocateBlock(capacity);
+        std::copy_n(_spriteSpatialGridPool.begin() + tile.Offset, count, _spriteSpatialGridPool.begin() + offset);
+        SpriteSpatialGridFreeBlock(tile);
+        tile.Offset = offset;
+        tile.Capacity = capacity;
+    }
+
+    uint16_t* entities = _spriteSpatialGridPool.data() + tile.Offset;
+    uint16_t* begin = entities + SpriteSpatialGridGetListStart(tile, sprite->sprite_identifier);
+    uint16_t* end = begin + tile.Counts[sprite->sprite_identifier];
+    auto it = std::lower_bound(begin, end, sprite->sprite_index, std::greater<uint16_t>());
+    if (it == end || *it != sprite->sprite_index)
+    {
+        // Shift this list's tail and the lists after it along by one.
+        std::copy_backward(it, entities + count, entities + count + 1);
+        *it = sprite->sprite_index;
+        tile.Counts[sprite->sprite_identifier]++;
+    }
+    entry = { static_cast<uint32_t>(index), sprite->sprite_identifier };
+}
+
+static void SpriteSpatialGridRemove(SpriteBase* sprite)
+{
+    auto& entry = _spriteSpatialGridEntries[sprite->sprite_index];
+    if (entry.Identifier >= SPATIAL_GRID_IDENTIFIER_COUNT)
+        return;
+
+    auto& tile = _spriteSpatialGrid[entry.Index];
+    auto count = SpriteSpatialGridGetTileCount(tile);
+    uint16_t* entities = _spriteSpatialGridPool.data() + tile.Offset;
+    uint16_t* begin = entities + SpriteSpatialGridGetListStart(tile, entry.Identifier);
+    uint16_t* end = begin + tile.Counts[entry.Identifier];
+    auto it = std::lower_bound(begin, end, sprite->sprite_index, std::greater<uint16_t>());
+    if (it != end && *it == sprite->sprite_index)
+    {
+        std::copy(it + 1, entities + count, it);
+        tile.Counts[entry.Identifier]--;
+        if (count == 1)
+        {
+            SpriteSpatialGridFreeBlock(tile);
+        }
+    }
+    entry = {};
 }
 
 static void SpriteSpatialMove(SpriteBase* sprite, const CoordsXY& newLoc)
@@ -757,6 +949,8 @@ void sprite_remove(SpriteBase* sprite)
         spriteIndex = &quadrantSprite->next_in_quadrant;
     }
     *spriteIndex = sprite->next_in_quadrant;
+
+    SpriteSpatialGridRemove(sprite);
 }
 
 static bool litter_can_be_at(int32_t x, int32_t y, int32_t z)
@@ -16,6 +16,8 @@
 #include "Fountain.h"
 #include "SpriteBase.h"
 
+#include <type_traits>
+
 #define SPRITE_INDEX_NULL 0xFFFF
 #define MAX_SPRITES 10000
 
@@ -208,6 +210,7 @@ extern uint16_t gSpriteListCount[SPRITE_LIST_COUNT];
 constexpr const uint32_t SPATIAL_INDEX_SIZE = (MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL) + 1;
 constexpr const uint32_t SPATIAL_INDEX_LOCATION_NULL = SPATIAL_INDEX_SIZE - 1;
 extern uint16_t gSpriteSpatialIndex[SPATIAL_INDEX_SIZE];
+constexpr const uint8_t SPATIAL_GRID_IDENTIFIER_COUNT = SPRITE_IDENTIFIER_LITTER + 1;
 
 extern const rct_string_id litterNames[12];
 
@@ -215,6 +218,7 @@ rct_sprite* create_sprite(SPRITE_IDENTIFIER spriteIdentifier);
 rct_sprite* create_sprite(SPRITE_IDENTIFIER spriteIdentifier, SPRITE_LIST linkedListIndex);
 void reset_sprite_list();
 void reset_sprite_spatial_index();
+void reset_sprite_spatial_grid();
 void sprite_clear_all_unused();
 void sprite_misc_update_all();
 void sprite_set_coordinates(int16_t x, int16_t y, int16_t z, SpriteBase* sprite);
@@ -225,6 +229,8 @@ uint16_t remove_floating_sprites();
 void sprite_misc_explosion_cloud_create(int32_t x, int32_t y, int32_t z);
 void sprite_misc_explosion_flare_create(int32_t x, int32_t y, int32_t z);
 uint16_t sprite_get_first_in_quadrant(int32_t x, int32_t y);
+/** Returns the entity listed after spriteIndex on the tile, or the first one when spriteIndex is SPRITE_INDEX_NULL. */
+uint16_t sprite_get_spatial_grid_next(const CoordsXY& loc, SPRITE_IDENTIFIER spriteIdentifier, uint16_t spriteIndex);
 void sprite_position_tween_store_a();
 void sprite_position_tween_store_b();
 void sprite_position_tween_all(float nudge);
@@ -318,25 +324,124 @@ public:
     using iterator_category = std::forward_iterator_tag;
 };
 
+/**
+ * Iterates the entities listed for one tile and sprite identifier in the spatial grid. Like EntityIterator, the next
+ * entity is looked up before the current one is handed out so that the current entity can be moved or removed.
+ */
+template<typename T> class EntityGridIterator
+{
+private:
+    CoordsXY Location;
+    SPRITE_IDENTIFIER Identifier;
+    T* Entity = nullptr;
+    uint16_t NextEntityId = SPRITE_INDEX_NULL;
+
+public:
+    EntityGridIterator(const CoordsXY& loc, SPRITE_IDENTIFIER identifier)
+        : Location(loc)
+        , Identifier(identifier)
+    {
+        NextEntityId = sprite_get_spatial_grid_next(Location, Identifier, SPRITE_INDEX_NULL);
+        ++(*this);
+    }
+    EntityGridIterator& operator++()
+    {
+        Entity = nullptr;
+
+        while (NextEntityId != SPRITE_INDEX_NULL && Entity == nullptr)
+        {
+            auto baseEntity = GetEntity(NextEntityId);
+            NextEntityId = sprite_get_spatial_grid_next(Location, Identifier, NextEntityId);
+
+            if (baseEntity != nullptr)
+            {
+                Entity = baseEntity->template As<T>();
+            }
+        }
+        return *this;
+    }
+
+    EntityGridIterator operator++(int)
+    {
+        EntityGridIterator retval = *this;
+        ++(*this);
+        return retval;
+    }
+    bool operator==(EntityGridIterator other) const
+    {
+        return Entity == other.Entity;
+    }
+    bool operator!=(EntityGridIterator other) const
+    {
+        return !(*this == other);
+    }
+    T* operator*()
+    {
+        return Entity;
+    }
+    // iterator traits
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+    using pointer = const T*;
+    using reference = const T&;
+    using iterator_category = std::forward_iterator_tag;
+};
+
+/**
+ * Returns the sprite identifier shared by every entity of type T, or SPRITE_IDENTIFIER_NULL if T covers entities with
+ * different identifiers.
+ */
+template<typename T> constexpr SPRITE_IDENTIFIER GetEntitySpriteIdentifier()
+{
+    if constexpr (std::is_base_of_v<Vehicle, T>)
+        return SPRITE_IDENTIFIER_VEHICLE;
+    else if constexpr (std::is_base_of_v<Peep, T>)
+        return SPRITE_IDENTIFIER_PEEP;
+    else if constexpr (std::is_same_v<Litter, T>)
+        return SPRITE_IDENTIFIER_LITTER;
+    else if constexpr (
+        std::is_same_v<MoneyEffect, T> || (std::is_base_of_v<SpriteGeneric, T> && !std::is_same_v<SpriteGeneric, T>))
+        return SPRITE_IDENTIFIER_MISC;
+    else
+        return SPRITE_IDENTIFIER_NULL;
+}
+
+/**
+ * Iterates the entities of type T on a tile. Types with a single sprite identifier only walk the entities of that
+ * identifier in the spatial grid, other types walk the next_in_quadrant list of the tile.
+ */
 template<typename T = SpriteBase> class EntityTileList
 {
 private:
+    static constexpr SPRITE_IDENTIFIER Identifier = GetEntitySpriteIdentifier<T>();
+    static constexpr bool UsesSpatialGrid = Identifier != SPRITE_IDENTIFIER_NULL;
+
+    CoordsXY Location;
     uint16_t FirstEntity = SPRITE_INDEX_NULL;
-    using EntityTileIterator = EntityIterator<T, &SpriteBase::next_in_quadrant>;
+    using EntityTileIterator = std::conditional_t<
+        UsesSpatialGrid, EntityGridIterator<T>, EntityIterator<T, &SpriteBase::next_in_quadrant>>;
 
 public:
     EntityTileList(const CoordsXY& loc)
-        : FirstEntity(sprite_get_first_in_quadrant(loc.x, loc.y))
+        : Location(loc)
     {
+        if constexpr (!UsesSpatialGrid)
+            FirstEntity = sprite_get_first_in_quadrant(loc.x, loc.y);
     }
 
     EntityTileIterator begin()
     {
-        return EntityTileIterator(FirstEntity);
+        if constexpr (UsesSpatialGrid)
+            return EntityTileIterator(Location, Identifier);
+        else
+            return EntityTileIterator(FirstEntity);
     }
     EntityTileIterator end()
     {
-        return EntityTileIterator(SPRITE_INDEX_NULL);
+        if constexpr (UsesSpatialGrid)
+            return EntityTileIterator(Location, SPRITE_IDENTIFIER_NULL);
+        else
+            return EntityTileIterator(SPRITE_INDEX_NULL);
     }
 };
 
@@ -57,3 +57,52 @@ TEST_F(ImageImporterTests, Import_Logo)
     ASSERT_EQ(0xCEF27C7D, hash);
     free(result.Buffer);
 }
+
+static Image CreateGradientImage()
+{
+    Image image;
+    image.Width = 256;
+    image.Height = 256;
+    image.Depth = 32;
+    image.Stride = image.Width * 4;
+    image.Pixels.resize(image.Stride * image.Height);
+    for (uint32_t y = 0; y < image.Height; y++)
+    {
+        for (uint32_t x = 0; x < image.Width; x++)
+        {
+            auto pixel = &image.Pixels[y * image.Stride + x * 4];
+            pixel[0] = static_cast<uint8_t>(x);
+            pixel[1] = static_cast<uint8_t>(y);
+            pixel[2] = static_cast<uint8_t>(x * 7 + y * 3);
+            pixel[3] = ((x / 16 + y / 16) % 5 == 0) ? 0 : 255;
+        }
+    }
+    return image;
+}
+
+TEST_F(ImageImporterTests, Import_Gradient_Closest)
+{
+    ImageImporter importer;
+    auto image = CreateGradientImage();
+    auto result = importer.Import(image, 0, 0, ImageImporter::IMPORT_FLAGS::NONE, ImageImporter::IMPORT_MODE::CLOSEST);
+
+    // Check to ensure the closest palette colours don't change unexpectedly.
+    ASSERT_NE(nullptr, result.Buffer);
+    ASSERT_EQ(256u * 256u, result.BufferLength);
+    auto hash = GetHash(result.Buffer, result.BufferLength);
+    ASSERT_EQ(0xC2C93F65, hash);
+    free(result.Buffer);
+}
+
+TEST_F(ImageImporterTests, Import_Gradient_Dithering)
+{
+    ImageImporter importer;
+    auto image = CreateGradientImage();
+    auto result = importer.Import(image, 0, 0, ImageImporter::IMPORT_FLAGS::RLE, ImageImporter::IMPORT_MODE::DITHERING);
+
+    // Check to ensure the dithered RLE data doesn't change unexpectedly.
+    ASSERT_NE(nullptr, result.Buffer);
+    auto hash = GetHash(result.Buffer, result.BufferLength);
+    ASSERT_EQ(0x1A2E94FE, hash);
+    free(result.Buffer);
+}
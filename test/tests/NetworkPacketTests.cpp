@@ -0,0 +1,259 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <openrct2/actions/ClearAction.hpp>
+#include <openrct2/actions/ParkSetNameAction.hpp>
+#include <openrct2/core/DataSerialiser.h>
+#include <openrct2/core/MemoryStream.h>
+#include <openrct2/network/NetworkConnection.h>
+#include <openrct2/network/NetworkPacket.h>
+#include <openrct2/network/NetworkTypes.h>
+#include <openrct2/network/Socket.h>
+#include <vector>
+
+/**
+ * A socket that hands out the given bytes a few at a time and records everything sent to it.
+ */
+class TestSocket final : public ITcpSocket
+{
+public:
+    std::vector<uint8_t> Received;
+    std::vector<uint8_t> Sent;
+    size_t ReceivedOffset = 0;
+    size_t MaxChunkSize = SIZE_MAX;
+
+    SOCKET_STATUS GetStatus() const override
+    {
+        return SOCKET_STATUS_CONNECTED;
+    }
+    const char* GetError() const override
+    {
+        return nullptr;
+    }
+    const char* GetHostName() const override
+    {
+        return nullptr;
+    }
+    std::string GetIpAddress() const override
+    {
+        return {};
+    }
+
+    void Listen(uint16_t port) override
+    {
+    }
+    void Listen(const std::string& address, uint16_t port) override
+    {
+    }
+    std::unique_ptr<ITcpSocket> Accept() override
+    {
+        return nullptr;
+    }
+
+    void Connect(const std::string& address, uint16_t port) override
+    {
+    }
+    void ConnectAsync(const std::string& address, uint16_t port) override
+    {
+    }
+
+    size_t SendData(const void* buffer, size_t size) override
+    {
+        auto bytes = static_cast<const uint8_t*>(buffer);
+        Sent.insert(Sent.end(), bytes, bytes + size);
+        return size;
+    }
+    size_t SendData(const SocketBuffer* buffers, size_t count) override
+    {
+        size_t totalSize = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            totalSize += SendData(buffers[i].Data, buffers[i].Size);
+        }
+        return totalSize;
+    }
+    NETWORK_READPACKET ReceiveData(void* buffer, size_t size, size_t* sizeReceived) override
+    {
+        size_t readBytes = std::min({ size, MaxChunkSize, Received.size() - ReceivedOffset });
+        *sizeReceived = readBytes;
+        if (readBytes == 0)
+        {
+            return NETWORK_READPACKET_NO_DATA;
+        }
+        std::memcpy(buffer, &Received[ReceivedOffset], readBytes);
+        ReceivedOffset += readBytes;
+        return NETWORK_READPACKET_SUCCESS;
+    }
+
+    void Disconnect() override
+    {
+    }
+    void Close() override
+    {
+    }
+};
+
+class NetworkPacketTests : public testing::Test
+{
+protected:
+    static std::unique_ptr<NetworkPacket> CreatePacket(size_t size)
+    {
+        auto packet = NetworkPacket::Allocate();
+        *packet << static_cast<uint32_t>(NETWORK_COMMAND_SCRIPTS);
+        auto& data = *packet->Data;
+        size_t commandSize = data.size();
+        data.resize(size);
+        for (size_t i = commandSize; i < size; i++)
+        {
+            data[i] = static_cast<uint8_t>(i * 7);
+        }
+        return packet;
+    }
+
+    static std::vector<uint8_t> Send(std::unique_ptr<NetworkPacket> packet)
+    {
+        NetworkConnection connection;
+        connection.AuthStatus = NETWORK_AUTH_OK;
+        connection.Socket = std::make_unique<TestSocket>();
+        connection.QueuePacket(std::move(packet));
+        connection.SendQueuedPackets();
+        EXPECT_EQ(connection.GetQueuedPacketCount(), 0U);
+        return static_cast<TestSocket*>(connection.Socket.get())->Sent;
+    }
+
+    static int32_t Receive(NetworkConnection& connection, const std::vector<uint8_t>& data)
+    {
+        auto socket = std::make_unique<TestSocket>();
+        socket->Received = data;
+        socket->MaxChunkSize = 3;
+        connection.Socket = std::move(socket);
+
+        int32_t status;
+        do
+        {
+            status = connection.ReadPacket();
+        } while (status == NETWORK_READPACKET_MORE_DATA);
+        return status;
+    }
+
+    static std::vector<uint8_t> CreateExtendedHeader(uint32_t size)
+    {
+        // WriteHeader only uses the extended header where it is needed, so build it by hand for any size.
+        std::vector<uint8_t> header(NETWORK_PACKET_EXTENDED_HEADER_SIZE);
+        header[2] = static_cast<uint8_t>(size >> 24);
+        header[3] = static_cast<uint8_t>(size >> 16);
+        header[4] = static_cast<uint8_t>(size >> 8);
+        header[5] = static_cast<uint8_t>(size);
+        return header;
+    }
+
+    static void AssertRoundTrip(size_t size, size_t expectedHeaderSize)
+    {
+        auto packet = CreatePacket(size);
+        auto expected = *packet->Data;
+        ASSERT_EQ(NetworkPacket::GetHeaderSize(static_cast<uint32_t>(size)), expectedHeaderSize);
+
+        auto sent = Send(std::move(packet));
+        ASSERT_EQ(sent.size(), expectedHeaderSize + size);
+
+        NetworkConnection connection;
+        connection.AuthStatus = NETWORK_AUTH_OK;
+        ASSERT_EQ(Receive(connection, sent), NETWORK_READPACKET_SUCCESS);
+        ASSERT_EQ(connection.InboundPacket.Size, size);
+        ASSERT_EQ(*connection.InboundPacket.Data, expected);
+    }
+};
+
+TEST_F(NetworkPacketTests, WriteHeader)
+{
+    uint8_t header[NETWORK_PACKET_EXTENDED_HEADER_SIZE] = {};
+
+    ASSERT_EQ(NetworkPacket::WriteHeader(header, 65535), NETWORK_PACKET_HEADER_SIZE);
+    ASSERT_EQ(header[0], 0xFF);
+    ASSERT_EQ(header[1], 0xFF);
+
+    ASSERT_EQ(NetworkPacket::WriteHeader(header, 65536), NETWORK_PACKET_EXTENDED_HEADER_SIZE);
+    const uint8_t expected[] = { 0x00, 0x00, 0x00, 0x01, 0x00, 0x00 };
+    ASSERT_EQ(std::memcmp(header, expected, sizeof(expected)), 0);
+}
+
+TEST_F(NetworkPacketTests, RoundTripLargestShortPacket)
+{
+    AssertRoundTrip(65535, NETWORK_PACKET_HEADER_SIZE);
+}
+
+TEST_F(NetworkPacketTests, RoundTripSmallestExtendedPacket)
+{
+    AssertRoundTrip(65536, NETWORK_PACKET_EXTENDED_HEADER_SIZE);
+}
+
+TEST_F(NetworkPacketTests, SendTooLarge)
+{
+    NetworkConnection connection;
+    connection.AuthStatus = NETWORK_AUTH_OK;
+    connection.Socket = std::make_unique<TestSocket>();
+    connection.QueuePacket(CreatePacket(NETWORK_PACKET_MAX_SIZE + 1));
+    ASSERT_EQ(connection.GetQueuedPacketCount(), 0U);
+}
+
+TEST_F(NetworkPacketTests, ReceiveMaxSize)
+{
+    // Only the header is given, the connection must be waiting for the data rather than rejecting the packet.
+    NetworkConnection connection;
+    connection.AuthStatus = NETWORK_AUTH_OK;
+    ASSERT_EQ(Receive(connection, CreateExtendedHeader(NETWORK_PACKET_MAX_SIZE)), NETWORK_READPACKET_NO_DATA);
+    ASSERT_EQ(connection.InboundPacket.Size, NETWORK_PACKET_MAX_SIZE);
+}
+
+TEST_F(NetworkPacketTests, ReceiveTooLarge)
+{
+    NetworkConnection connection;
+    connection.AuthStatus = NETWORK_AUTH_OK;
+    ASSERT_EQ(Receive(connection, CreateExtendedHeader(NETWORK_PACKET_MAX_SIZE + 1)), NETWORK_READPACKET_DISCONNECTED);
+}
+
+TEST_F(NetworkPacketTests, ReceiveZeroSize)
+{
+    NetworkConnection connection;
+    connection.AuthStatus = NETWORK_AUTH_OK;
+    ASSERT_EQ(Receive(connection, CreateExtendedHeader(0)), NETWORK_READPACKET_DISCONNECTED);
+}
+
+TEST_F(NetworkPacketTests, GameActionStreamMatchesMemoryStream)
+{
+    ParkSetNameAction parkSetNameAction("Test Park");
+    ClearAction clearAction({ 32, 64, 320, 640 }, CLEARABLE_ITEMS::SCENERY_SMALL | CLEARABLE_ITEMS::SCENERY_FOOTPATH);
+    clearAction.SetFlags(GAME_COMMAND_FLAG_APPLY);
+    clearAction.SetNetworkId(12);
+    const GameAction* actions[] = { &parkSetNameAction, &clearAction };
+
+    for (const auto* action : actions)
+    {
+        MemoryStream stream;
+        DataSerialiser ds(true, stream);
+        action->Serialise(ds);
+        auto streamData = static_cast<const uint8_t*>(stream.GetData());
+        std::vector<uint8_t> expected(streamData, streamData + stream.GetLength());
+
+        // The action must follow whatever the packet already holds.
+        auto packet = NetworkPacket::Allocate();
+        *packet << static_cast<uint32_t>(NETWORK_COMMAND_GAME_ACTION) << action->GetType();
+        size_t headerSize = packet->Data->size();
+        NetworkPacketStream packetStream(*packet);
+        DataSerialiser packetDs(true, packetStream);
+        action->Serialise(packetDs);
+
+        std::vector<uint8_t> actual(packet->Data->begin() + headerSize, packet->Data->end());
+        ASSERT_EQ(actual, expected);
+        ASSERT_EQ(packet->GetCommand(), NETWORK_COMMAND_GAME_ACTION);
+    }
+}
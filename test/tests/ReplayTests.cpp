@@ -100,6 +100,7 @@ TEST_P(ReplayTests, RunReplay)
         gs->UpdateLogic();
         ASSERT_TRUE(replayManager->IsPlaybackStateMismatching() == false);
     }
+    ASSERT_TRUE(replayManager->GetPlaybackMismatchTicks().empty());
 #endif
 }
 
@@ -21,17 +21,70 @@
 #include <openrct2/ride/Ride.h>
 #include <openrct2/ride/RideData.h>
 #include <string>
+#include <vector>
 
 using namespace OpenRCT2;
 
 class RideRatings : public testing::Test
 {
 protected:
-    void CalculateRatingsForAllRides()
+    void ResetRatings()
     {
+        // Closed rides are skipped by the calculation and keep the ratings they were saved with
         for (const auto& ride : GetRideManager())
         {
-            ride_ratings_update_ride(ride);
+            if (ride.status != RIDE_STATUS_CLOSED)
+                get_ride(ride.id)->ratings = { RIDE_RATING_UNDEFINED, RIDE_RATING_UNDEFINED, RIDE_RATING_UNDEFINED };
+        }
+    }
+
+    void CalculateRatingsTickByTick()
+    {
+        // Step the state machine from the first ride index until it has been through every ride index once
+        gRideRatingsCalcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+        gRideRatingsCalcData.current_ride = MAX_RIDES - 1;
+        do
+        {
+            ride_ratings_update_all();
+        } while (gRideRatingsCalcData.state != RIDE_RATINGS_STATE_FIND_NEXT_RIDE
+                 || gRideRatingsCalcData.current_ride != MAX_RIDES - 1);
+    }
+
+    void CalculateRatingsBatched()
+    {
+        std::vector<ride_id_t> rideIds;
+        for (const auto& ride : GetRideManager())
+        {
+            rideIds.push_back(ride.id);
+        }
+        ride_ratings_update_rides(rideIds);
+    }
+
+    std::vector<std::string> GetRatings()
+    {
+        std::vector<std::string> ratings;
+        for (const auto& ride : GetRideManager())
+        {
+            ratings.push_back(FormatRatings(ride));
+        }
+        return ratings;
+    }
+
+    void CheckRatings()
+    {
+        // Load expected ratings
+        auto expectedDataPath = Path::Combine(TestData::GetBasePath(), "ratings", "bpb.sv6.txt");
+        auto expectedRatings = File::ReadAllLines(expectedDataPath);
+
+        // Check ride ratings
+        int expI = 0;
+        for (const auto& ride : GetRideManager())
+        {
+            auto actual = FormatRatings(ride);
+            auto expected = expectedRatings[expI];
+            ASSERT_STREQ(actual.c_str(), expected.c_str());
+
+            expI++;
         }
     }
 
@@ -71,20 +124,35 @@ TEST_F(RideRatings, all)
     // Check ride count to check load was successful
     ASSERT_EQ(ride_get_count(), 134);
 
-    CalculateRatingsForAllRides();
+    ResetRatings();
+    CalculateRatingsTickByTick();
+    CheckRatings();
 
-    // Load expected ratings
-    auto expectedDataPath = Path::Combine(TestData::GetBasePath(), "ratings", "bpb.sv6.txt");
-    auto expectedRatings = File::ReadAllLines(expectedDataPath);
+    // The batched calculation must give the same results as the tick by tick state machine
+    auto tickByTickRatings = GetRatings();
+    ResetRatings();
+    CalculateRatingsBatched();
+    ASSERT_EQ(GetRatings(), tickByTickRatings);
+}
 
-    // Check ride ratings
-    int expI = 0;
-    for (const auto& ride : GetRideManager())
-    {
-        auto actual = FormatRatings(ride);
-        auto expected = expectedRatings[expI];
-        ASSERT_STREQ(actual.c_str(), expected.c_str());
+TEST_F(RideRatings, batched)
+{
+    std::string path = TestData::GetParkPath("bpb.sv6");
 
-        expI++;
-    }
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    core_init();
+    auto context = CreateContext();
+    bool initialised = context->Initialise();
+    ASSERT_TRUE(initialised);
+
+    load_from_sv6(path.c_str());
+
+    // Check ride count to check load was successful
+    ASSERT_EQ(ride_get_count(), 134);
+
+    ResetRatings();
+    CalculateRatingsBatched();
+    CheckRatings();
 }